@@ -644,6 +644,11 @@ ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
     SEND_STRING_ENABLE := yes
 endif
 
+ifeq ($(strip $(SEND_STRING_ASYNC_ENABLE)), yes)
+    SEND_STRING_ENABLE := yes
+    OPT_DEFS += -DSEND_STRING_ASYNC_ENABLE
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
@@ -659,6 +664,7 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+        QUANTUM_SRC += $(QUANTUM_DIR)/matrix_gather.c
     endif
 endif
 
@@ -669,12 +675,17 @@ ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
 endif
 
 
-VALID_SERIAL_DRIVER_TYPES := bitbang usart vendor
+VALID_SERIAL_DRIVER_TYPES := bitbang usart vendor loopback
 
 SERIAL_DRIVER ?= bitbang
 ifeq ($(filter $(SERIAL_DRIVER),$(VALID_SERIAL_DRIVER_TYPES)),)
     $(call CATASTROPHIC_ERROR,Invalid SERIAL_DRIVER,SERIAL_DRIVER="$(SERIAL_DRIVER)" is not a valid SERIAL driver)
 endif
+ifeq ($(strip $(SERIAL_DRIVER)), loopback)
+    ifneq ($(strip $(PLATFORM_KEY)), test)
+        $(call CATASTROPHIC_ERROR,Invalid SERIAL_DRIVER,SERIAL_DRIVER="loopback" is only available for tests)
+    endif
+endif
 
 ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     POST_CONFIG_H += $(QUANTUM_DIR)/split_common/post_config.h
@@ -703,10 +714,19 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
         OPT_DEFS += -DSERIAL_DRIVER_$(strip $(shell echo $(SERIAL_DRIVER) | tr '[:lower:]' '[:upper:]'))
         ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
             QUANTUM_LIB_SRC += serial.c
+        else ifeq ($(strip $(SERIAL_DRIVER)), loopback)
+            # Host only, both halves in one test binary -- test builds don't link QUANTUM_LIB_SRC
+            COMMON_VPATH += $(PLATFORM_PATH)/test/drivers
+            QUANTUM_SRC += $(PLATFORM_PATH)/test/drivers/serial_loopback.c
         else
             QUANTUM_LIB_SRC += serial_protocol.c
             QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
         endif
+
+        ifeq ($(strip $(SPLIT_MATRIX_DELTA_ENABLE)), yes)
+            OPT_DEFS += -DSPLIT_MATRIX_DELTA_ENABLE
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_matrix_delta.c
+        endif
     endif
     COMMON_VPATH += $(QUANTUM_PATH)/split_common
 endif
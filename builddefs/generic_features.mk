@@ -38,12 +38,14 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILER \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
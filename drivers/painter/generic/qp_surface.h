@@ -21,6 +21,25 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_TILE_SIZE
+/**
+ * @def This controls the width and height, in pixels, of the tiles a surface tracks its dirty area with. Only dirty
+ *      tiles are transferred when drawing the surface to a display, instead of the bounding box of everything drawn
+ *      since the last transfer. Must be a power of two, or 0 (the default) to only keep track of the bounding box.
+ *      Tracking tiles costs up to SURFACE_DIRTY_MAX_TILES bits of RAM on every surface, including those embedded in
+ *      OLED panels.
+ */
+#    define SURFACE_DIRTY_TILE_SIZE 0
+#endif
+
+#ifndef SURFACE_DIRTY_MAX_TILES
+/**
+ * @def This controls the maximum number of tiles tracked for each surface, each costing a bit of RAM. Surfaces that
+ *      would need more tiles than this use larger tiles instead.
+ */
+#    define SURFACE_DIRTY_MAX_TILES 512
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
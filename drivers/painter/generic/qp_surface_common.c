@@ -29,7 +29,42 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+#if SURFACE_DIRTY_TILE_SIZE > 0
+_Static_assert((SURFACE_DIRTY_TILE_SIZE & (SURFACE_DIRTY_TILE_SIZE - 1)) == 0, "SURFACE_DIRTY_TILE_SIZE must be a power of two");
+
+static void surface_dirty_tiles_init(surface_dirty_data_t *dirty, uint16_t width, uint16_t height) {
+    // Start at the configured tile size, doubling it until the tiles covering the surface fit
+    dirty->tile_shift = 0;
+    while ((1 << dirty->tile_shift) < SURFACE_DIRTY_TILE_SIZE) {
+        dirty->tile_shift++;
+    }
+    while (true) {
+        dirty->tiles_wide = (width + (1 << dirty->tile_shift) - 1) >> dirty->tile_shift;
+        dirty->tiles_high = (height + (1 << dirty->tile_shift) - 1) >> dirty->tile_shift;
+        if ((uint32_t)dirty->tiles_wide * dirty->tiles_high <= SURFACE_DIRTY_MAX_TILES) {
+            break;
+        }
+        dirty->tile_shift++;
+    }
+}
+
+static inline bool surface_dirty_tile_is_set(const surface_dirty_data_t *dirty, uint16_t tile_x, uint16_t tile_y) {
+    uint16_t tile = tile_y * dirty->tiles_wide + tile_x;
+    return (dirty->tiles[tile / 8] & (1 << (tile % 8))) ? true : false;
+}
+#endif // SURFACE_DIRTY_TILE_SIZE > 0
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    // Mark the tile containing the pixel
+    uint16_t tile_x = x >> dirty->tile_shift;
+    uint16_t tile_y = y >> dirty->tile_shift;
+    if (tile_x < dirty->tiles_wide && tile_y < dirty->tiles_high) {
+        uint16_t tile = tile_y * dirty->tiles_wide + tile_x;
+        dirty->tiles[tile / 8] |= (1 << (tile % 8));
+    }
+#endif
+
     // Maintain dirty region
     if (dirty->l > x) {
         dirty->l        = x;
@@ -63,6 +98,11 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    surface_dirty_tiles_init(&surface->dirty, driver->panel_width, driver->panel_height);
+    memset(surface->dirty.tiles, 0xFF, sizeof(surface->dirty.tiles));
+#endif
+
     return true;
 }
 
@@ -83,6 +123,9 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    memset(surface->dirty.tiles, 0, sizeof(surface->dirty.tiles));
+#endif
     return true;
 }
 
@@ -105,6 +148,46 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
+bool qp_surface_transfer_dirty_regions(surface_painter_device_t *surface, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, surface_region_transfer_func transfer) {
+    surface_dirty_data_t *dirty = &surface->dirty;
+
+    if (entire_surface) {
+        return transfer(surface, target_driver, x, y, 0, 0, surface->base.panel_width - 1, surface->base.panel_height - 1);
+    }
+
+#if SURFACE_DIRTY_TILE_SIZE > 0
+    // Send each horizontal run of dirty tiles as its own region, so far apart changes don't drag everything in between
+    // along. Runs are clipped to the bounding box, which also keeps them within the panel.
+    if (dirty->tiles_wide > 0) {
+        for (uint16_t tile_y = 0; tile_y < dirty->tiles_high; ++tile_y) {
+            uint16_t tile_x = 0;
+            while (tile_x < dirty->tiles_wide) {
+                if (!surface_dirty_tile_is_set(dirty, tile_x, tile_y)) {
+                    ++tile_x;
+                    continue;
+                }
+
+                uint16_t first_tile_x = tile_x;
+                while (tile_x < dirty->tiles_wide && surface_dirty_tile_is_set(dirty, tile_x, tile_y)) {
+                    ++tile_x;
+                }
+
+                uint16_t l = MAX((uint32_t)first_tile_x << dirty->tile_shift, dirty->l);
+                uint16_t t = MAX((uint32_t)tile_y << dirty->tile_shift, dirty->t);
+                uint16_t r = MIN(((uint32_t)tile_x << dirty->tile_shift) - 1, dirty->r);
+                uint16_t b = MIN(((uint32_t)(tile_y + 1) << dirty->tile_shift) - 1, dirty->b);
+                if (l <= r && t <= b && !transfer(surface, target_driver, x, y, l, t, r, b)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+#endif
+
+    return transfer(surface, target_driver, x, y, dirty->l, dirty->t, dirty->r, dirty->b);
+}
+
 bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t x, uint16_t y, bool entire_surface) {
     painter_driver_t *        surface_driver = (painter_driver_t *)surface;
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
@@ -22,6 +22,14 @@ typedef struct surface_dirty_data_t {
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+#    if SURFACE_DIRTY_TILE_SIZE > 0
+    // Dirty tiles within the bounding box, one bit each, row by row
+    uint8_t  tile_shift;
+    uint16_t tiles_wide;
+    uint16_t tiles_high;
+    uint8_t  tiles[(SURFACE_DIRTY_MAX_TILES + 7) / 8];
+#    endif
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -90,6 +98,12 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
 
+// Transfers the inclusive region l/t/r/b of the surface to the target, drawn with the surface's top left at x/y
+typedef bool (*surface_region_transfer_func)(surface_painter_device_t *surface, painter_driver_t *target_driver, uint16_t x, uint16_t y, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
+
+// Splits the dirty area into one region per run of dirty tiles, or the whole surface, and transfers each of them
+bool qp_surface_transfer_dirty_regions(surface_painter_device_t *surface, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, surface_region_transfer_func transfer);
+
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,10 +24,14 @@ Example:
   lenght        -> length
   ouput         -> output
   widht         -> width
+With --external, the trie is instead written to "autocorrect_data.bin" for
+storing on external flash, and "autocorrect_data.h" only describes it.
 For full documentation, see QMK Docs
 """
 
+import struct
 import textwrap
+from collections import deque
 from typing import Any, Dict, Iterator, List, Tuple
 
 from milc import cli
@@ -43,6 +47,9 @@ KC_A = 4
 KC_SPC = 0x2c
 KC_QUOT = 0x34
 
+EXTERNAL_MAGIC = b'QKAC'
+EXTERNAL_HEADER_SIZE = 8
+
 TYPO_CHARS = dict([
     ("'", KC_QUOT),
     (':', KC_SPC),  # "Word break" character.
@@ -165,11 +172,13 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
-def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
+def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any], link_size: int = 2, page_size: int = 0) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
     autocorrections: List of (typo, correction) tuples.
     trie: Dict of dicts.
+    link_size: Number of bytes used for node links, 2 or 3.
+    page_size: If nonzero, clusters nodes so that lookups touch few pages of this size.
   Returns:
     List of ints in the range 0-255.
   """
@@ -220,25 +229,72 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
         else:  # Handle a branch table entry.
             data = []
             for c, link in zip(e['chars'], e['links']):
-                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link)
+                data += [TYPO_CHARS[c] | (0 if data else 64)] + encode_link(link, link_size)
             return data + [0]
 
+    # A chain entry is followed by its child, so chains are kept together with their child
+    def entry_size(e: Dict[str, Any]) -> int:
+        size = len(serialize(e))
+        if len(e['links']) == 1:
+            size += entry_size(e['links'][0])
+        return size
+
+    def place(e: Dict[str, Any]) -> List[Dict[str, Any]]:
+        placed = [e]
+        while len(e['links']) == 1:
+            e = e['links'][0]
+            placed.append(e)
+        return placed
+
+    if page_size:
+        # Lookups walk from the root towards a leaf, so fill the remainder of each page with the nodes closest to the
+        # root of the current subtree in breadth first order, then continue with the subtrees that did not fit.
+        ordered = []
+        offset = 0
+        clusters = deque([table[0]])
+        while clusters:
+            root = clusters.popleft()
+            size = entry_size(root)
+            budget = page_size - offset % page_size
+            if budget < size <= page_size:
+                # Pad to a fresh page rather than splitting the subtree root across two
+                ordered.append({'data': [0] * budget, 'links': []})
+                offset += budget
+                budget = page_size
+            while budget < size:
+                budget += page_size
+            frontier = deque([root])
+            overflow = []
+            while frontier:
+                e = frontier.popleft()
+                size = entry_size(e)
+                if e is not root and size > budget:
+                    overflow.append(e)
+                    continue
+                for placed in place(e):
+                    ordered.append(placed)
+                budget -= size
+                offset += size
+                frontier.extend(ordered[-1]['links'])
+            clusters.extendleft(reversed(overflow))
+        table = ordered
+
     byte_offset = 0
     for e in table:  # To encode links, first compute byte offset of each entry.
         e['byte_offset'] = byte_offset
         byte_offset += len(serialize(e))
-        assert 0 <= byte_offset <= 0xffff
+        assert 0 <= byte_offset < (1 << (8 * link_size))
 
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
-def encode_link(link: Dict[str, Any]) -> List[int]:
-    """Encodes a node link as two bytes."""
+def encode_link(link: Dict[str, Any], link_size: int = 2) -> List[int]:
+    """Encodes a node link as `link_size` little endian bytes."""
     byte_offset = link['byte_offset']
-    if not (0 <= byte_offset <= 0xffff):
-        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+    if not (0 <= byte_offset < (1 << (8 * link_size))):
+        cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds %dKB limit. Try reducing the autocorrection dict to fewer entries, or use --external.', 1 << (8 * link_size - 10))
         maybe_exit(1)
-    return [byte_offset & 255, byte_offset >> 8]
+    return [(byte_offset >> (8 * i)) & 255 for i in range(link_size)]
 
 
 def typo_len(e: Tuple[str, str]) -> int:
@@ -253,12 +309,17 @@ def to_hex(b: int) -> str:
 @cli.argument('-kb', '--keyboard', type=keyboard_folder, completer=keyboard_completer, help='The keyboard to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-e', '--external', arg_only=True, action='store_true', help='Write the dictionary to autocorrect_data.bin, for storing on external flash')
+@cli.argument('-p', '--page-size', arg_only=True, type=int, default=256, help='Page size the external dictionary is laid out for (Default: 256)')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.external:
+        data = serialize_trie(autocorrections, trie, link_size=3, page_size=cli.args.page_size)
+    else:
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -266,6 +327,10 @@ def generate_autocorrect_data(cli):
     if current_keyboard and current_keymap:
         cli.args.output = locate_keymap(current_keyboard, current_keymap).parent / 'autocorrect_data.h'
 
+    if cli.args.external and not cli.args.output:
+        cli.log.error('{fg_red}Error:{fg_reset} An output file or keymap is required with --external.')
+        maybe_exit(1)
+
     assert all(0 <= b <= 255 for b in data)
 
     min_typo = min(autocorrections, key=typo_len)[0]
@@ -282,10 +347,22 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
-    autocorrect_data_h_lines.append('')
-    autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
-    autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
-    autocorrect_data_h_lines.append('};')
+
+    if cli.args.external:
+        # The trie itself is stored externally, prefixed with a header identifying it
+        binary_file = cli.args.output.with_suffix('.bin')
+        binary_file.write_bytes(EXTERNAL_MAGIC + struct.pack('<I', len(data)) + bytes(data))
+
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append(f'// Stored in {binary_file.name}, {EXTERNAL_HEADER_SIZE} byte header followed by the trie')
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_DICTIONARY_EXTERNAL')
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_LINK_SIZE 3')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_DICTIONARY_PAGE_SIZE {cli.args.page_size}')
+    else:
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
+        autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
+        autocorrect_data_h_lines.append('};')
 
     # Show the results
     dump_lines(cli.args.output, autocorrect_data_h_lines, cli.args.quiet)
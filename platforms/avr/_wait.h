@@ -45,6 +45,7 @@ extern void __builtin_avr_delay_cycles(uint32_t);
 
 #define wait_ms(ms)                             \
     do {                                        \
+        wait_ms_hook();                         \
         if (__builtin_constant_p(ms)) {         \
             _delay_ms(ms);                      \
         } else {                                \
@@ -22,6 +22,7 @@
 /* chThdSleepX of zero maps to infinite - so we map to a tiny delay to still yield */
 #define wait_ms(ms)                     \
     do {                                \
+        wait_ms_hook();                 \
         if (ms != 0) {                  \
             chThdSleepMilliseconds(ms); \
         } else {                        \
@@ -0,0 +1,196 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "color.h"
+#include "qp_internal.h"
+#include "qp_draw.h"
+#include "qp_comms_dummy.h"
+#include "qp_host.h"
+
+typedef struct qp_host_device_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    // Current viewport, and write location within it when streaming pixel data
+    uint16_t viewport_l;
+    uint16_t viewport_t;
+    uint16_t viewport_r;
+    uint16_t viewport_b;
+    uint16_t pixdata_x;
+    uint16_t pixdata_y;
+
+    uint64_t pixels_written;
+    uint8_t  pixels[]; // rgb888, row by row
+} qp_host_device_t;
+
+static inline size_t qp_host_pixels_size(const qp_host_device_t *host) {
+    return (size_t)host->base.panel_width * host->base.panel_height * 3;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Driver vtable
+
+static bool qp_host_init(painter_device_t device, painter_rotation_t rotation) {
+    qp_host_device_t *host = (qp_host_device_t *)device;
+    memset(host->pixels, 0, qp_host_pixels_size(host));
+    return true;
+}
+
+static bool qp_host_power(painter_device_t device, bool power_on) {
+    // No-op.
+    return true;
+}
+
+static bool qp_host_clear(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return qp_host_init(device, driver->rotation);
+}
+
+static bool qp_host_flush(painter_device_t device) {
+    // No-op, every pixel is already in memory.
+    return true;
+}
+
+static bool qp_host_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    qp_host_device_t *host = (qp_host_device_t *)device;
+    host->viewport_l = host->pixdata_x = left;
+    host->viewport_t = host->pixdata_y = top;
+    host->viewport_r                   = right;
+    host->viewport_b                   = bottom;
+    return true;
+}
+
+static bool qp_host_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_host_device_t *host = (qp_host_device_t *)device;
+    const uint8_t *   src  = (const uint8_t *)pixel_data;
+
+    for (uint32_t i = 0; i < native_pixel_count; ++i, src += 3) {
+        // Drop anything off-screen, as a panel would
+        if (host->pixdata_x < host->base.panel_width && host->pixdata_y < host->base.panel_height) {
+            memcpy(&host->pixels[((size_t)host->pixdata_y * host->base.panel_width + host->pixdata_x) * 3], src, 3);
+        }
+
+        // Move to the next location, wrapping around the viewport
+        if (++host->pixdata_x > host->viewport_r) {
+            host->pixdata_x = host->viewport_l;
+            if (++host->pixdata_y > host->viewport_b) {
+                host->pixdata_y = host->viewport_t;
+            }
+        }
+    }
+
+    host->pixels_written += native_pixel_count;
+    return true;
+}
+
+static bool qp_host_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        rgb_t rgb           = hsv_to_rgb_nocie((hsv_t){palette[i].hsv888.h, palette[i].hsv888.s, palette[i].hsv888.v});
+        palette[i].rgb888.r = rgb.r;
+        palette[i].rgb888.g = rgb.g;
+        palette[i].rgb888.b = rgb.b;
+    }
+    return true;
+}
+
+static bool qp_host_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    qp_internal_palette_to_rgb888(target_buffer, palette, pixel_offset, pixel_count, palette_indices);
+    return true;
+}
+
+static bool qp_host_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+static const painter_driver_vtable_t host_driver_vtable = {
+    .init            = qp_host_init,
+    .power           = qp_host_power,
+    .clear           = qp_host_clear,
+    .flush           = qp_host_flush,
+    .viewport        = qp_host_viewport,
+    .pixdata         = qp_host_pixdata,
+    .palette_convert = qp_host_palette_convert,
+    .append_pixels   = qp_host_append_pixels,
+    .append_pixdata  = qp_host_append_pixdata,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Device lifetime and access
+
+painter_device_t qp_host_make_device(uint16_t panel_width, uint16_t panel_height) {
+    qp_host_device_t *host = calloc(1, sizeof(qp_host_device_t) + (size_t)panel_width * panel_height * 3);
+    if (!host) {
+        return NULL;
+    }
+
+    host->base.driver_vtable         = &host_driver_vtable;
+    host->base.comms_vtable          = &dummy_comms_vtable;
+    host->base.native_bits_per_pixel = 24;
+    host->base.panel_width           = panel_width;
+    host->base.panel_height          = panel_height;
+    host->base.rotation              = QP_ROTATION_0;
+    return (painter_device_t)host;
+}
+
+void qp_host_free_device(painter_device_t device) {
+    free((void *)device);
+}
+
+const uint8_t *qp_host_pixels(painter_device_t device) {
+    return ((const qp_host_device_t *)device)->pixels;
+}
+
+uint64_t qp_host_pixels_written(painter_device_t device) {
+    return ((const qp_host_device_t *)device)->pixels_written;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PPM images
+
+bool qp_host_save_ppm(painter_device_t device, const char *filename) {
+    const qp_host_device_t *host = (const qp_host_device_t *)device;
+
+    FILE *f = fopen(filename, "wb");
+    if (!f) {
+        return false;
+    }
+
+    fprintf(f, "P6\n%u %u\n255\n", (unsigned)host->base.panel_width, (unsigned)host->base.panel_height);
+    bool ok = fwrite(host->pixels, 1, qp_host_pixels_size(host), f) == qp_host_pixels_size(host);
+    return (fclose(f) == 0) && ok;
+}
+
+int32_t qp_host_compare_ppm(painter_device_t device, const char *filename) {
+    const qp_host_device_t *host = (const qp_host_device_t *)device;
+
+    FILE *f = fopen(filename, "rb");
+    if (!f) {
+        return -1;
+    }
+
+    // Header fields are separated by whitespace, with a single whitespace character before the pixel data
+    unsigned width, height, max_value;
+    if (fscanf(f, "P6 %u %u %u", &width, &height, &max_value) != 3 || fgetc(f) == EOF || width != host->base.panel_width || height != host->base.panel_height || max_value != 255) {
+        fclose(f);
+        return -1;
+    }
+
+    int32_t differences = 0;
+    for (size_t offset = 0; offset < qp_host_pixels_size(host); offset += 3) {
+        uint8_t expected[3];
+        if (fread(expected, 1, sizeof(expected), f) != sizeof(expected)) {
+            differences = -1;
+            break;
+        }
+        if (memcmp(expected, &host->pixels[offset], sizeof(expected)) != 0) {
+            differences++;
+        }
+    }
+
+    fclose(f);
+    return differences;
+}
@@ -0,0 +1,43 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qp.h"
+
+/*
+    Host painter device, selected with `QUANTUM_PAINTER_DRIVERS += host`.
+
+    Renders into memory as rows of rgb888 pixels, the way an RGB panel would
+    show them, so that drawing code can be run, inspected and timed on the
+    host. Its contents can be saved as, and compared against, binary PPM
+    images. Rotation and offsets are ignored, like surfaces do.
+*/
+
+/**
+ * \brief Creates a host device, allocating its pixels.
+ *
+ * \return the device handle used with all drawing routines in Quantum Painter, or NULL if it could not be allocated.
+ */
+painter_device_t qp_host_make_device(uint16_t panel_width, uint16_t panel_height);
+
+/** \brief Frees a device created by qp_host_make_device(). */
+void qp_host_free_device(painter_device_t device);
+
+/** \brief The device's pixels, rgb888 row by row. */
+const uint8_t *qp_host_pixels(painter_device_t device);
+
+/** \brief Number of pixels streamed to the device since it was created, including any falling outside of it. */
+uint64_t qp_host_pixels_written(painter_device_t device);
+
+/** \brief Saves the device's pixels as a binary PPM (P6) image. */
+bool qp_host_save_ppm(painter_device_t device, const char *filename);
+
+/**
+ * \brief Compares the device's pixels against a binary PPM (P6) image.
+ *
+ * \return the number of differing pixels, or -1 if the image could not be read or its size doesn't match the device.
+ */
+int32_t qp_host_compare_ppm(painter_device_t device, const char *filename);
@@ -0,0 +1,238 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "serial.h"
+#include "serial_loopback.h"
+
+// The slave's stand-in main loop runs at about the rate of a real scan
+#define SLAVE_TASK_INTERVAL_NS 1000000ULL
+
+static int   link_fd     = -1;
+static bool  link_closed = false;
+static pid_t slave_pid   = -1;
+
+static serial_loopback_stats_t stats[NUM_TOTAL_TRANSACTIONS];
+
+static uint64_t timestamp_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static bool link_send(const void *source, size_t size) {
+    const uint8_t *data = source;
+    while (size > 0) {
+        ssize_t sent = send(link_fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+/* Receives exactly `size` bytes, waiting at most `timeout` milliseconds for each chunk, or forever if negative. */
+static bool link_receive(void *destination, size_t size, int timeout) {
+    uint8_t *data = destination;
+    while (size > 0) {
+        struct pollfd link = {.fd = link_fd, .events = POLLIN};
+        int           ready = poll(&link, 1, timeout);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            return false;
+        }
+        ssize_t received = recv(link_fd, data, size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            link_closed = received == 0;
+            return false;
+        }
+        data += received;
+        size -= received;
+    }
+    return true;
+}
+
+/* Drops bytes left over from a failed transaction, to start with a clean slate. */
+static void link_clear(void) {
+    uint8_t discard[64];
+    while (recv(link_fd, discard, sizeof(discard), MSG_DONTWAIT) > 0) {
+    }
+}
+
+////////////////////////////////////////////////////
+// Slave
+
+static bool react_to_transaction(void) {
+    uint8_t transaction_id = 0;
+    if (!link_receive(&transaction_id, sizeof(transaction_id), -1) || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *transaction = &split_transaction_table[transaction_id];
+
+    // Same handshake as serial_protocol.c, the ID XORed as a simple checksum
+    uint8_t handshake = transaction_id ^ NUM_TOTAL_TRANSACTIONS;
+    if (!link_send(&handshake, sizeof(handshake))) {
+        return false;
+    }
+
+    if (transaction->initiator2target_buffer_size) {
+        if (!link_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, SERIAL_LOOPBACK_TIMEOUT)) {
+            return false;
+        }
+    }
+
+    if (transaction->slave_callback) {
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->target2initiator_buffer_size, split_trans_target2initiator_buffer(transaction));
+    }
+
+    if (transaction->target2initiator_buffer_size) {
+        if (!link_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void slave_loop(void (*slave_task)(void)) {
+    uint64_t next_task = 0;
+    while (!link_closed) {
+        uint64_t now = timestamp_ns();
+        if (slave_task && now >= next_task) {
+            slave_task();
+            next_task = now + SLAVE_TASK_INTERVAL_NS;
+        }
+
+        struct pollfd link    = {.fd = link_fd, .events = POLLIN};
+        int           timeout = slave_task ? (int)((next_task - now + 999999) / 1000000) : -1;
+        if (poll(&link, 1, timeout) > 0 && !react_to_transaction() && !link_closed) {
+            link_clear();
+        }
+    }
+}
+
+void soft_serial_target_init(void) {}
+
+////////////////////////////////////////////////////
+// Master
+
+void soft_serial_initiator_init(void) {}
+
+static bool initiate_transaction(uint8_t transaction_id) {
+    if (link_fd < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+
+    split_transaction_desc_t *transaction = &split_transaction_table[transaction_id];
+
+    uint8_t handshake = 0xFF;
+    if (!link_send(&transaction_id, sizeof(transaction_id)) || !link_receive(&handshake, sizeof(handshake), SERIAL_LOOPBACK_TIMEOUT) || handshake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: handshake failed\n");
+        return false;
+    }
+
+    if (transaction->initiator2target_buffer_size) {
+        if (!link_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size)) {
+            serial_dprintf("SPLIT: sending buffer failed\n");
+            return false;
+        }
+    }
+
+    if (transaction->target2initiator_buffer_size) {
+        if (!link_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size, SERIAL_LOOPBACK_TIMEOUT)) {
+            serial_dprintf("SPLIT: receiving buffer failed\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool soft_serial_transaction(int index) {
+    link_clear();
+
+    uint64_t start = timestamp_ns();
+    bool     okay  = initiate_transaction((uint8_t)index);
+    uint64_t took  = timestamp_ns() - start;
+
+    if (index >= 0 && index < NUM_TOTAL_TRANSACTIONS) {
+        serial_loopback_stats_t *s = &stats[index];
+        s->count++;
+        s->errors += !okay;
+        s->total_ns += took;
+        if (took > s->max_ns) {
+            s->max_ns = took;
+        }
+    }
+    return okay;
+}
+
+bool serial_loopback_start(void (*slave_init)(void), void (*slave_task)(void)) {
+    int link[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, link) != 0) {
+        return false;
+    }
+
+    // Anything still buffered would otherwise be printed by both halves
+    fflush(stdout);
+    fflush(stderr);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(link[0]);
+        close(link[1]);
+        return false;
+    }
+    if (pid == 0) {
+        close(link[0]);
+        link_fd     = link[1];
+        link_closed = false;
+        if (slave_init) {
+            slave_init();
+        }
+        slave_loop(slave_task);
+        _exit(0);
+    }
+
+    close(link[1]);
+    link_fd     = link[0];
+    link_closed = false;
+    slave_pid   = pid;
+    serial_loopback_reset_stats();
+    return true;
+}
+
+void serial_loopback_stop(void) {
+    if (link_fd >= 0) {
+        close(link_fd);
+        link_fd = -1;
+    }
+    if (slave_pid > 0) {
+        waitpid(slave_pid, NULL, 0);
+        slave_pid = -1;
+    }
+}
+
+const serial_loopback_stats_t *serial_loopback_get_stats(int8_t transaction_id) {
+    return transaction_id >= 0 && transaction_id < NUM_TOTAL_TRANSACTIONS ? &stats[transaction_id] : NULL;
+}
+
+void serial_loopback_reset_stats(void) {
+    memset(stats, 0, sizeof(stats));
+}
@@ -0,0 +1,48 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transaction_id_define.h"
+
+/*
+    Host loopback serial driver, selected with `SERIAL_DRIVER = loopback`.
+
+    serial_loopback_start() forks the process: the child becomes the slave
+    half and the caller stays the master, the two connected by a socketpair.
+    Transactions go over it with the same handshake as serial_protocol.c, so
+    transport.c and transactions.c run unchanged on both sides. Between
+    transactions the child runs `slave_task`, standing in for the slave's
+    main loop, until the master calls serial_loopback_stop().
+*/
+
+/** \brief How long the master waits for the slave to answer, in milliseconds of real time. */
+#ifndef SERIAL_LOOPBACK_TIMEOUT
+#    define SERIAL_LOOPBACK_TIMEOUT 100
+#endif
+
+/** \brief Round trips of one transaction ID as seen by the master, in nanoseconds of real time. */
+typedef struct {
+    uint32_t count;
+    uint32_t errors;
+    uint64_t total_ns;
+    uint64_t max_ns;
+} serial_loopback_stats_t;
+
+/**
+ * \brief Forks the slave half.
+ *
+ * \param slave_init runs once in the child before the first transaction, may be NULL.
+ * \param slave_task runs in the child whenever no transaction is pending, may be NULL.
+ * \return false in the master if the slave could not be started. Never returns in the child.
+ */
+bool serial_loopback_start(void (*slave_init)(void), void (*slave_task)(void));
+
+/** \brief Disconnects the slave half and waits for it to exit. */
+void serial_loopback_stop(void);
+
+const serial_loopback_stats_t *serial_loopback_get_stats(int8_t transaction_id);
+
+void serial_loopback_reset_stats(void);
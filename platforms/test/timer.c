@@ -15,6 +15,7 @@
  */
 
 #include "timer.h"
+#include "wait.h"
 #include <stdatomic.h>
 
 static atomic_uint_least32_t current_time      = 0;
@@ -71,5 +72,6 @@ void advance_time(uint32_t ms) {
 }
 
 void wait_ms(uint32_t ms) {
+    wait_ms_hook();
     advance_time(ms);
 }
@@ -21,6 +21,14 @@
 extern "C" {
 #endif
 
+#ifdef KEYBOARD_REPORT_COALESCE
+/* A keyboard report held back for coalescing is sent before blocking, so the host sees it ahead of the delay */
+void keyboard_report_flush(void);
+#    define wait_ms_hook() keyboard_report_flush()
+#else
+#    define wait_ms_hook()
+#endif
+
 #if __has_include_next("_wait.h")
 #    include_next "_wait.h" /* Include the platforms _wait.h */
 #endif
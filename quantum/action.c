@@ -26,6 +26,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "action_layer.h"
 #include "action_tapping.h"
 #include "action_util.h"
+#include "profiler.h"
 #include "action.h"
 #include "wait.h"
 #include "keycode_config.h"
@@ -131,7 +132,7 @@ void action_exec(keyevent_t event) {
     }
 #    endif
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
-        action_tapping_process(record);
+        PROFILER_CALL("action_tapping_process", action_tapping_process(record));
     }
 #else
     if (IS_NOEVENT(record.event) || pre_process_record_quantum(&record)) {
@@ -281,11 +282,14 @@ void process_record(keyrecord_t *record) {
     if (IS_NOEVENT(record->event)) {
         return;
     }
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process(&record->event.trace);
+#endif
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
 
-    if (!process_record_quantum(record)) {
+    if (!PROFILER_EVAL("process_record_quantum", process_record_quantum(record))) {
 #ifndef NO_ACTION_ONESHOT
         if (is_oneshot_layer_active() && record->event.pressed && keymap_config.oneshot_enable) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
@@ -294,7 +298,7 @@ void process_record(keyrecord_t *record) {
         return;
     }
 
-    process_record_handler(record);
+    PROFILER_CALL("process_record_handler", process_record_handler(record));
     post_process_record_quantum(record);
 }
 
@@ -1,11 +1,13 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
 #include "encoder.h"
 #include "util.h"
 #include "action_layer.h"
+#include "print.h"
 
 /** \brief Default Layer State
  */
@@ -46,6 +48,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_debug();
     ac_dprintf(" to ");
     default_layer_state = state;
+    layer_switch_cache_invalidate();
     default_layer_debug();
     ac_dprintf("\n");
 #if defined(STRICT_LAYER_RELEASE)
@@ -136,6 +139,7 @@ void layer_state_set(layer_state_t state) {
     layer_debug();
     ac_dprintf(" to ");
     layer_state = state;
+    layer_switch_cache_invalidate();
     layer_debug();
     ac_dprintf("\n");
 #    if defined(STRICT_LAYER_RELEASE)
@@ -335,16 +339,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Layer switch find layer
  *
- * Gets the layer based on key info
+ * Scans the active layers from the top for the first non-transparent action
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_switch_find_layer(layer_state_t layers, keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -356,6 +359,90 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_SWITCH_CACHE_ENABLE)
+/** \brief layer switch cache
+ *
+ * Topmost non-transparent layer of each matrix position, valid for the
+ * layer stack captured in layer_switch_cache_layers.
+ */
+#    define LAYER_SWITCH_CACHE_EMPTY 0xFF
+
+static uint8_t                    layer_switch_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t              layer_switch_cache_layers = 0;
+static bool                       layer_switch_cache_dirty  = true;
+static layer_switch_cache_stats_t layer_switch_cache_stats  = {0};
+
+/** \brief layer switch cache invalidate
+ *
+ * Drops all resolved layers; the cache is refilled lazily on the next lookups
+ */
+void layer_switch_cache_invalidate(void) {
+    if (!layer_switch_cache_dirty) {
+        layer_switch_cache_dirty = true;
+        layer_switch_cache_stats.invalidations++;
+    }
+}
+
+/** \brief layer switch cache get stats
+ *
+ * Returns the hit, miss and invalidation counters of the cache
+ */
+layer_switch_cache_stats_t layer_switch_cache_get_stats(void) {
+    return layer_switch_cache_stats;
+}
+
+/** \brief layer switch cache debug
+ *
+ * Prints the cache counters to the console
+ */
+void layer_switch_cache_debug(void) {
+    xprintf("layer_switch_cache: hits %lu misses %lu invalidations %lu\n", (unsigned long)layer_switch_cache_stats.hits, (unsigned long)layer_switch_cache_stats.misses, (unsigned long)layer_switch_cache_stats.invalidations);
+}
+
+/** \brief layer switch cache get layer
+ *
+ * Returns the cached layer for a matrix position, resolving it on a miss
+ */
+static uint8_t layer_switch_cache_get_layer(keypos_t key) {
+    layer_state_t layers = layer_state | default_layer_state;
+
+    /* layer state may be written directly (e.g. split sync), so compare as well */
+    if (layer_switch_cache_dirty || layers != layer_switch_cache_layers) {
+        if (!layer_switch_cache_dirty) {
+            layer_switch_cache_stats.invalidations++;
+        }
+        memset(layer_switch_cache, LAYER_SWITCH_CACHE_EMPTY, sizeof(layer_switch_cache));
+        layer_switch_cache_layers = layers;
+        layer_switch_cache_dirty  = false;
+    }
+
+    uint8_t layer = layer_switch_cache[key.row][key.col];
+    if (layer == LAYER_SWITCH_CACHE_EMPTY) {
+        layer_switch_cache_stats.misses++;
+        layer                                = layer_switch_find_layer(layers, key);
+        layer_switch_cache[key.row][key.col] = layer;
+    } else {
+        layer_switch_cache_stats.hits++;
+    }
+    return layer;
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+#    ifdef LAYER_SWITCH_CACHE_ENABLE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return layer_switch_cache_get_layer(key);
+    }
+#    endif
+    return layer_switch_find_layer(layer_state | default_layer_state, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
@@ -166,6 +166,23 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+/* resolved layer cache */
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_SWITCH_CACHE_ENABLE)
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t invalidations;
+} layer_switch_cache_stats_t;
+
+/* forget every resolved layer, e.g. after the keymap has been modified */
+void layer_switch_cache_invalidate(void);
+
+layer_switch_cache_stats_t layer_switch_cache_get_stats(void);
+void                       layer_switch_cache_debug(void);
+#else
+#    define layer_switch_cache_invalidate()
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
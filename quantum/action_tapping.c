@@ -129,6 +129,9 @@ static void debug_waiting_buffer(void);
  * FIXME: Needs doc
  */
 void action_tapping_process(keyrecord_t record) {
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_mark(&record.event.trace, LATENCY_TRACE_COMBO);
+#endif
     if (process_tapping(&record)) {
         if (IS_EVENT(record.event)) {
             ac_dprintf("processed: ");
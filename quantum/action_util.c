@@ -282,33 +282,169 @@ static uint8_t get_mods_for_report(void) {
     return mods;
 }
 
-void send_6kro_report(void) {
-    keyboard_report->mods = get_mods_for_report();
+static report_keyboard_t last_6kro_report;
+#ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+#endif
 
-#ifdef PROTOCOL_VUSB
-    host_keyboard_send(keyboard_report);
-#else
-    static report_keyboard_t last_report;
+static void emit_6kro_report(report_keyboard_t *report) {
+#ifndef PROTOCOL_VUSB
+    /* Only send the report if there are changes to propagate to the host. */
+    if (memcmp(report, &last_6kro_report, sizeof(report_keyboard_t)) == 0) {
+        return;
+    }
+#endif
+    memcpy(&last_6kro_report, report, sizeof(report_keyboard_t));
+    host_keyboard_send(report);
+}
 
+#ifdef NKRO_ENABLE
+static void emit_nkro_report(report_nkro_t *report) {
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(keyboard_report, &last_report, sizeof(report_keyboard_t)) != 0) {
-        memcpy(&last_report, keyboard_report, sizeof(report_keyboard_t));
-        host_keyboard_send(keyboard_report);
+    if (memcmp(report, &last_nkro_report, sizeof(report_nkro_t)) == 0) {
+        return;
     }
+    memcpy(&last_nkro_report, report, sizeof(report_nkro_t));
+    host_nkro_send(report);
+}
 #endif
+
+#ifdef KEYBOARD_REPORT_COALESCE
+static uint8_t           report_transaction_depth = 0;
+static bool              pending_6kro             = false;
+static report_keyboard_t pending_6kro_report;
+#    ifdef NKRO_ENABLE
+static bool          pending_nkro = false;
+static report_nkro_t pending_nkro_report;
+#    endif
+
+/** \brief Checks whether replacing the pending report `pending` with `next` would hide changes from the host
+ *
+ * `sent` is the report the host last received, `keys_added` tells whether `pending` and `next` each press keys
+ * that their predecessor did not.
+ */
+static bool report_mods_need_flush(uint8_t sent, uint8_t pending, uint8_t next, bool pending_keys_added, bool next_keys_added) {
+    // A modifier pressed and released again, or released and pressed again, would vanish from the merged report
+    if ((~sent & pending & ~next) || (sent & ~pending & next)) {
+        return true;
+    }
+#    ifndef KEYBOARD_REPORT_COALESCE_MODS
+    // Keep the order between a modifier change and a key press, e.g. Shift then A must not become Shift+A at once
+    if ((sent != pending && next_keys_added) || (pending_keys_added && pending != next)) {
+        return true;
+    }
+#    endif
+    return false;
+}
+
+static bool report_6kro_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool report_6kro_keys_added(const report_keyboard_t *from, const report_keyboard_t *to) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (to->keys[i] && !report_6kro_has_key(from, to->keys[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool report_6kro_needs_flush(const report_keyboard_t *sent, const report_keyboard_t *pending, const report_keyboard_t *next) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = pending->keys[i];
+        if (key && !report_6kro_has_key(sent, key) && !report_6kro_has_key(next, key)) {
+            return true;
+        }
+        key = sent->keys[i];
+        if (key && !report_6kro_has_key(pending, key) && report_6kro_has_key(next, key)) {
+            return true;
+        }
+    }
+    return report_mods_need_flush(sent->mods, pending->mods, next->mods, report_6kro_keys_added(sent, pending), report_6kro_keys_added(pending, next));
+}
+
+#    ifdef NKRO_ENABLE
+static bool report_nkro_needs_flush(const report_nkro_t *sent, const report_nkro_t *pending, const report_nkro_t *next) {
+    bool pending_keys_added = false;
+    bool next_keys_added    = false;
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((~sent->bits[i] & pending->bits[i] & ~next->bits[i]) || (sent->bits[i] & ~pending->bits[i] & next->bits[i])) {
+            return true;
+        }
+        pending_keys_added |= (pending->bits[i] & ~sent->bits[i]) != 0;
+        next_keys_added |= (next->bits[i] & ~pending->bits[i]) != 0;
+    }
+    return report_mods_need_flush(sent->mods, pending->mods, next->mods, pending_keys_added, next_keys_added);
+}
+#    endif
+
+/** \brief Starts coalescing keyboard reports, transactions can be nested
+ */
+void keyboard_report_begin(void) {
+    report_transaction_depth++;
+}
+
+/** \brief Ends a transaction, sending the coalesced report when the outermost one ends
+ */
+void keyboard_report_commit(void) {
+    if (report_transaction_depth && --report_transaction_depth == 0) {
+        keyboard_report_flush();
+    }
+}
+
+/** \brief Sends the report held back by the current transaction, if any
+ */
+void keyboard_report_flush(void) {
+    if (pending_6kro) {
+        pending_6kro = false;
+        emit_6kro_report(&pending_6kro_report);
+    }
+#    ifdef NKRO_ENABLE
+    if (pending_nkro) {
+        pending_nkro = false;
+        emit_nkro_report(&pending_nkro_report);
+    }
+#    endif
+}
+#endif
+
+void send_6kro_report(void) {
+    keyboard_report->mods = get_mods_for_report();
+
+#ifdef KEYBOARD_REPORT_COALESCE
+    if (report_transaction_depth) {
+        if (pending_6kro && report_6kro_needs_flush(&last_6kro_report, &pending_6kro_report, keyboard_report)) {
+            emit_6kro_report(&pending_6kro_report);
+        }
+        memcpy(&pending_6kro_report, keyboard_report, sizeof(report_keyboard_t));
+        pending_6kro = true;
+        return;
+    }
+#endif
+    emit_6kro_report(keyboard_report);
 }
 
 #ifdef NKRO_ENABLE
 void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
-
-    /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
-        memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
-        host_nkro_send(nkro_report);
+#    ifdef KEYBOARD_REPORT_COALESCE
+    if (report_transaction_depth) {
+        if (pending_nkro && report_nkro_needs_flush(&last_nkro_report, &pending_nkro_report, nkro_report)) {
+            emit_nkro_report(&pending_nkro_report);
+        }
+        memcpy(&pending_nkro_report, nkro_report, sizeof(report_nkro_t));
+        pending_nkro = true;
+        return;
     }
+#    endif
+    emit_nkro_report(nkro_report);
 }
 #endif
 
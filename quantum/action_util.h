@@ -32,6 +32,24 @@ extern report_nkro_t *nkro_report;
 
 void send_keyboard_report(void);
 
+/* report coalescing
+ *
+ * Between keyboard_report_begin() and keyboard_report_commit() send_keyboard_report() only takes a snapshot of the
+ * report, and the last snapshot is sent once at commit. Changes that would be lost or reordered by merging (a key
+ * pressed and released again, a modifier change and a key press from separate events) send the earlier snapshot first.
+ * keyboard_report_flush() sends the pending snapshot right away. wait_ms() and the mouse, system and consumer sends in
+ * host.c call it, so the host sees the report before a delay or another kind of report.
+ */
+#ifdef KEYBOARD_REPORT_COALESCE
+void keyboard_report_begin(void);
+void keyboard_report_commit(void);
+void keyboard_report_flush(void);
+#else
+static inline void keyboard_report_begin(void) {}
+static inline void keyboard_report_commit(void) {}
+static inline void keyboard_report_flush(void) {}
+#endif
+
 /* key */
 inline void add_key(uint8_t key) {
     add_key_to_report(key);
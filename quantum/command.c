@@ -34,6 +34,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "quantum.h"
 #include "usb_device_state.h"
 #include "version.h"
+#include "profiler.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -157,6 +158,11 @@ static void command_common_help(void) {
 #ifdef SLEEP_LED_ENABLE
         STR(MAGIC_KEY_SLEEP_LED) ":	Sleep LED Test\n"
 #endif
+
+#ifdef PROFILER_ENABLE
+        STR(MAGIC_KEY_PROFILER) ":	Print Profiler Statistics\n"
+        STR(MAGIC_KEY_PROFILER_RESET) ":	Reset Profiler Statistics\n"
+#endif
     ); /* clang-format on */
 }
 
@@ -239,6 +245,9 @@ static void print_status(void) {
         , timer_read32()
 
     ); /* clang-format on */
+#if !defined(NO_ACTION_LAYER) && defined(LAYER_SWITCH_CACHE_ENABLE)
+    layer_switch_cache_debug();
+#endif
 }
 
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
@@ -330,6 +339,20 @@ static bool command_common(uint8_t code) {
             break;
 #endif
 
+#ifdef PROFILER_ENABLE
+
+        // print profiler probes
+        case MAGIC_KC(MAGIC_KEY_PROFILER):
+            profiler_dump();
+            break;
+
+        // reset profiler probes
+        case MAGIC_KC(MAGIC_KEY_PROFILER_RESET):
+            print("Profiler reset\n");
+            profiler_reset();
+            break;
+#endif
+
         // print stored eeprom config
         case MAGIC_KC(MAGIC_KEY_EEPROM):
 #if !defined(NO_PRINT) && !defined(USER_PRINT)
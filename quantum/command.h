@@ -153,6 +153,14 @@ bool command_proc(uint8_t code);
 #    define MAGIC_KEY_NKRO N
 #endif
 
+#ifndef MAGIC_KEY_PROFILER
+#    define MAGIC_KEY_PROFILER P
+#endif
+
+#ifndef MAGIC_KEY_PROFILER_RESET
+#    define MAGIC_KEY_PROFILER_RESET R
+#endif
+
 #ifndef MAGIC_KEY_SLEEP_LED
 #    define MAGIC_KEY_SLEEP_LED Z
 
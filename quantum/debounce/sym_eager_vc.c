@@ -0,0 +1,187 @@
+/*
+Copyright 2025 QMK
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+Per-key algorithm using vertical counters, behaving like sym_eager_pk.
+Bit n of every key's counter is stored in the same matrix_row_t, so a whole row
+of counters is updated with a few bitwise operations per counter bit instead of
+once per key. Memory is allocated statically, for MATRIX_ROWS rows.
+After pressing a key, it immediately changes state, and sets a counter.
+No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of counter bits needed to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+// A key is debouncing while any bit of its counter is set
+static matrix_row_t counters[COUNTER_BITS][MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         matrix_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(counters, 0, sizeof(counters));
+    counters_need_update = false;
+    matrix_need_update   = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters(num_rows, elapsed_time);
+        }
+    }
+
+    if (changed || matrix_need_update) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        transfer_matrix_values(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static matrix_row_t running_debounce_counters(uint8_t row) {
+    matrix_row_t running = 0;
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        running |= counters[bit][row];
+    }
+    return running;
+}
+
+// Subtract elapsed_time from all running counters of a row, stopping and returning those that reach zero
+static matrix_row_t count_down_debounce_counters(uint8_t row, matrix_row_t running, uint8_t elapsed_time) {
+    matrix_row_t expired = running;
+
+    if (elapsed_time < DEBOUNCE) {
+        // Ripple borrow subtraction, one counter bit of every key at a time
+        matrix_row_t borrow  = 0;
+        matrix_row_t nonzero = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            matrix_row_t value = counters[bit][row];
+            if (elapsed_time & (1 << bit)) {
+                counters[bit][row] = ~value ^ borrow;
+                borrow             = ~value | borrow;
+            } else {
+                counters[bit][row] = value ^ borrow;
+                borrow             = ~value & borrow;
+            }
+            nonzero |= counters[bit][row];
+        }
+        expired = running & (borrow | ~nonzero);
+    }
+
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        counters[bit][row] &= running & ~expired;
+    }
+    return expired;
+}
+
+// If the current time is > debounce counter, set the counter to enable input.
+static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    matrix_need_update   = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t running = running_debounce_counters(row);
+        if (!running) {
+            continue;
+        }
+
+        matrix_row_t expired = count_down_debounce_counters(row, running, elapsed_time);
+        if (expired) {
+            matrix_need_update = true;
+        }
+        if (running & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+// upload from raw_matrix to final matrix;
+static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    matrix_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        // Changed keys that are not debouncing flip immediately and start their counter at DEBOUNCE
+        matrix_row_t flip = (raw[row] ^ cooked[row]) & ~running_debounce_counters(row);
+        if (!flip) {
+            continue;
+        }
+
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            if (DEBOUNCE & (1 << bit)) {
+                counters[bit][row] |= flip;
+            }
+        }
+        counters_need_update = true;
+        cooked[row] ^= flip;
+        cooked_changed = true;
+    }
+}
+
+#else
+#    include "none.c"
+#endif
@@ -0,0 +1,123 @@
+/* Copyright 2025 QMK
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+extern "C" {
+#include "debounce.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct Scan {
+    matrix_row_t raw[MATRIX_ROWS];
+    bool         changed;
+};
+
+/*
+ * Generates one 1ms scan per entry: every key_interval scans on average one key
+ * changes state, and bounces randomly for up to four scans afterwards.
+ */
+static std::vector<Scan> generate_scans(int count, int key_interval, int keys_per_change) {
+    std::mt19937      rng(1);
+    std::vector<Scan> scans(count);
+    matrix_row_t      raw[MATRIX_ROWS]    = {0};
+    matrix_row_t      target[MATRIX_ROWS] = {0};
+    int               bounces             = 0;
+
+    for (auto &scan : scans) {
+        if (bounces == 0 && rng() % key_interval == 0) {
+            for (int i = 0; i < keys_per_change; i++) {
+                target[rng() % MATRIX_ROWS] ^= MATRIX_ROW_SHIFTER << (rng() % MATRIX_COLS);
+            }
+            bounces = 1 + rng() % 4;
+        }
+        scan.changed = false;
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            matrix_row_t next = target[row];
+            if (bounces > 1) {
+                next ^= (raw[row] ^ target[row]) & (matrix_row_t)rng();
+            }
+            scan.changed |= next != raw[row];
+            scan.raw[row] = raw[row] = next;
+        }
+        if (bounces) {
+            bounces--;
+        }
+    }
+    return scans;
+}
+
+/*
+ * Not a functional test: reports the host time spent in debounce() per 1ms scan
+ * on a MATRIX_ROWS x MATRIX_COLS matrix, to compare algorithms.
+ */
+static void run_benchmark(const char *name, const std::vector<Scan> &scans) {
+    matrix_row_t cooked[MATRIX_ROWS] = {0};
+
+    debounce_init(MATRIX_ROWS);
+    set_time(7777);
+
+    auto start = std::chrono::steady_clock::now();
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t start_cycles = __rdtsc();
+#endif
+    for (const auto &scan : scans) {
+        debounce((matrix_row_t *)scan.raw, cooked, MATRIX_ROWS, scan.changed);
+        advance_time(1);
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t cycles = __rdtsc() - start_cycles;
+#else
+    uint64_t cycles = 0;
+#endif
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%s, %dx%d matrix, DEBOUNCE=%d: %.1f ns", name, MATRIX_ROWS, MATRIX_COLS, DEBOUNCE, (double)elapsed.count() / scans.size());
+    if (cycles) {
+        std::printf(", %.1f TSC cycles", (double)cycles / scans.size());
+    }
+    std::printf(" per scan\n");
+
+    // Everything has settled once the last bounce is over
+    const Scan &last = scans.back();
+    for (int i = 0; i < DEBOUNCE + 5; i++) {
+        debounce((matrix_row_t *)last.raw, cooked, MATRIX_ROWS, false);
+        advance_time(1);
+    }
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        EXPECT_EQ(cooked[row], last.raw[row]);
+    }
+    debounce_free();
+}
+
+TEST(DebounceBenchmark, Typing) {
+    run_benchmark("typing", generate_scans(500000, 30, 1));
+}
+
+TEST(DebounceBenchmark, Chording) {
+    run_benchmark("chording", generate_scans(500000, 8, 6));
+}
@@ -12,31 +12,144 @@
 //------------------------------------
 // Helpers
 //
+// Executors never move within the table, so a token maps directly to its slot: token = slot + 1 + generation * table_count.
+// The slots are additionally ordered by trigger time in a binary min-heap, which is stored in the heap_slot member of
+// the table entries -- table[i].heap_slot is the slot at heap position i, and table[slot].heap_index is its inverse.
+// The number of entries in the heap is kept in table[0].heap_count.
+//
+
+// Tokens are 8-bit, so only the first 127 slots are usable -- that leaves every slot at least two generations of tokens,
+// so that a released slot's next token always differs from its last one
+#define DEFERRED_EXEC_MAX_USABLE (UINT8_MAX / 2)
+
+_Static_assert((MAX_DEFERRED_EXECUTORS) <= DEFERRED_EXEC_MAX_USABLE, "MAX_DEFERRED_EXECUTORS must be at most 127");
+
+static inline size_t usable_count(size_t table_count) {
+    return table_count > DEFERRED_EXEC_MAX_USABLE ? DEFERRED_EXEC_MAX_USABLE : table_count;
+}
 
-static deferred_token current_token = 0;
+// Released slots keep their last token so that the next one can differ from it, liveness is determined by the heap
+static inline bool slot_in_use(deferred_executor_t *table, uint8_t slot) {
+    uint8_t index = table[slot].heap_index;
+    return index < table[0].heap_count && table[index].heap_slot == slot;
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
+static inline deferred_executor_t *entry_for_token(deferred_executor_t *table, size_t table_count, deferred_token token) {
     if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+        return NULL;
+    }
+    uint8_t slot = (token - 1) % table_count;
+    return table[slot].token == token && slot_in_use(table, slot) ? &table[slot] : NULL;
+}
+
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count, uint8_t slot) {
+    uint8_t        generations = UINT8_MAX / table_count;
+    deferred_token previous    = table[slot].token;
+    uint8_t        generation  = previous == INVALID_DEFERRED_TOKEN ? 0 : ((previous - 1) / table_count + 1) % generations;
+    return slot + 1 + generation * table_count;
+}
+
+static inline bool is_due(deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+static inline bool triggers_before(deferred_executor_t *table, uint8_t heap_a, uint8_t heap_b) {
+    return ((int32_t)TIMER_DIFF_32(table[table[heap_a].heap_slot].trigger_time, table[table[heap_b].heap_slot].trigger_time)) < 0;
+}
+
+static inline void heap_swap(deferred_executor_t *table, uint8_t heap_a, uint8_t heap_b) {
+    uint8_t slot_a           = table[heap_a].heap_slot;
+    uint8_t slot_b           = table[heap_b].heap_slot;
+    table[heap_a].heap_slot  = slot_b;
+    table[heap_b].heap_slot  = slot_a;
+    table[slot_a].heap_index = heap_b;
+    table[slot_b].heap_index = heap_a;
+}
+
+static void heap_sift_up(deferred_executor_t *table, uint8_t index) {
+    while (index > 0) {
+        uint8_t parent = (index - 1) / 2;
+        if (!triggers_before(table, index, parent)) {
+            break;
+        }
+        heap_swap(table, index, parent);
+        index = parent;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+}
+
+static void heap_sift_down(deferred_executor_t *table, uint8_t index) {
+    uint8_t count = table[0].heap_count;
+    while (true) {
+        uint8_t  smallest = index;
+        uint16_t left     = 2 * index + 1;
+        uint16_t right    = left + 1;
+        if (left < count && triggers_before(table, left, smallest)) {
+            smallest = left;
+        }
+        if (right < count && triggers_before(table, right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
         }
+        heap_swap(table, index, smallest);
+        index = smallest;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+// Restores the heap order after the trigger time of an executor has changed
+static inline void heap_update(deferred_executor_t *table, deferred_executor_t *entry) {
+    heap_sift_up(table, entry->heap_index);
+    heap_sift_down(table, entry->heap_index);
+}
+
+static void heap_insert(deferred_executor_t *table, uint8_t slot) {
+    uint8_t index          = table[0].heap_count++;
+    table[index].heap_slot = slot;
+    table[slot].heap_index = index;
+    heap_sift_up(table, index);
+}
+
+static void heap_remove(deferred_executor_t *table, deferred_executor_t *entry) {
+    uint8_t index = entry->heap_index;
+    uint8_t last  = --table[0].heap_count;
+    if (index != last) {
+        heap_swap(table, index, last);
+        heap_update(table, &table[table[index].heap_slot]);
+    }
+}
+
+static inline void release_entry(deferred_executor_t *table, deferred_executor_t *entry) {
+    heap_remove(table, entry);
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+// Earliest due executor that hasn't run yet during the current pass. That is the heap root, unless the root has already
+// run and is still behind schedule -- then the rest of the heap is searched, so that it doesn't hold up the others.
+#define NO_DUE_SLOT UINT8_MAX
+
+static uint8_t next_due_slot(deferred_executor_t *table, uint32_t now, const uint8_t *ran) {
+    uint8_t count = table[0].heap_count;
+    if (count == 0 || !is_due(&table[table[0].heap_slot], now)) {
+        return NO_DUE_SLOT;
+    }
+
+    uint8_t best = NO_DUE_SLOT;
+    for (uint8_t index = 0; index < count; ++index) {
+        uint8_t slot = table[index].heap_slot;
+        if ((ran[slot / 8] & (1 << (slot % 8))) || !is_due(&table[slot], now)) {
+            continue;
+        }
+        if (index == 0) {
+            return slot;
+        }
+        if (best == NO_DUE_SLOT || ((int32_t)TIMER_DIFF_32(table[slot].trigger_time, table[best].trigger_time)) < 0) {
+            best = slot;
         }
     }
-    return current_token;
+    return best;
 }
 
 //------------------------------------
@@ -50,21 +163,20 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
+    table_count = usable_count(table_count);
+    if (table[0].heap_count >= table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    for (uint8_t slot = 0; slot < table_count; ++slot) {
+        deferred_executor_t *entry = &table[slot];
+        if (!slot_in_use(table, slot)) {
             // Set up the executor table entry
-            entry->token        = current_token;
+            entry->token        = allocate_token(table, table_count, slot);
             entry->trigger_time = timer_read32() + delay_ms;
             entry->callback     = callback;
             entry->cb_arg       = cb_arg;
-            return current_token;
+            heap_insert(table, slot);
+            return entry->token;
         }
     }
 
@@ -79,17 +191,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = entry_for_token(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_update(table, entry);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,20 +209,22 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = entry_for_token(table, usable_count(table_count), token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    release_entry(table, entry);
+    return true;
+}
+
+bool deferred_exec_advanced_next_deadline(deferred_executor_t *table, size_t table_count, uint32_t *deadline) {
+    if (!table || table_count == 0 || table[0].heap_count == 0) {
+        return false;
+    }
+    *deadline = table[table[0].heap_slot].trigger_time;
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +234,38 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        if (!table || table_count == 0) {
+            return;
+        }
+
+        // Run through the executors that were due when the pass started, earliest first. Each executor runs at most once
+        // per pass, so one that has fallen behind catches up over subsequent passes rather than holding up the main loop.
+        uint8_t ran[(DEFERRED_EXEC_MAX_USABLE + 7) / 8] = {0};
+        uint8_t slot;
+        while ((slot = next_due_slot(table, now, ran)) != NO_DUE_SLOT) {
+            deferred_executor_t *entry      = &table[slot];
             deferred_token       curr_token = entry->token;
+            ran[slot / 8] |= 1 << (slot % 8);
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // If the token has changed or the slot was released, then the callback has canceled and possibly re-queued. Skip further processing.
+            if (entry->token != curr_token || !slot_in_use(table, slot)) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                heap_update(table, entry);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_entry(table, entry);
             }
         }
     }
@@ -172,6 +287,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_deadline(uint32_t *deadline) {
+    return deferred_exec_advanced_next_deadline(basic_executors, MAX_DEFERRED_EXECUTORS, deadline);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
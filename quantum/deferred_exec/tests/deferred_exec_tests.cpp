@@ -0,0 +1,316 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct Invocation {
+    int      id;
+    uint32_t trigger_time;
+    uint32_t now;
+};
+
+static std::vector<Invocation> invocations;
+
+struct CallbackState {
+    int                   id;
+    uint32_t              repeat_ms;
+    deferred_token        token;
+    std::function<void()> action;
+};
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    CallbackState *state = (CallbackState *)cb_arg;
+    invocations.push_back({state->id, trigger_time, timer_read32()});
+    if (state->action) {
+        state->action();
+    }
+    return state->repeat_ms;
+}
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Start close to the 32-bit wraparound, deadlines must be compared relative to each other
+        set_time(UINT32_MAX - 1000);
+        invocations.clear();
+        table.fill({});
+        last_execution = timer_read32();
+    }
+
+    deferred_token defer(uint32_t delay_ms, CallbackState *state) {
+        state->token = defer_exec_advanced(table.data(), table.size(), delay_ms, record_callback, state);
+        return state->token;
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table.data(), table.size(), &last_execution);
+        }
+    }
+
+    std::array<deferred_executor_t, 64> table;
+    uint32_t                            last_execution;
+};
+
+TEST_F(DeferredExec, RunsInDeadlineOrder) {
+    std::mt19937                  rng(1);
+    std::array<CallbackState, 64> states{};
+    std::multimap<uint32_t, int>  expected;
+    uint32_t                      start = timer_read32();
+    for (int i = 0; i < 64; i++) {
+        uint32_t delay = 1 + rng() % 500;
+        states[i]      = {i, 0, INVALID_DEFERRED_TOKEN, nullptr};
+        EXPECT_NE(defer(delay, &states[i]), INVALID_DEFERRED_TOKEN);
+        expected.emplace(delay, i);
+    }
+
+    run_for(500);
+    ASSERT_EQ(invocations.size(), 64);
+    auto it = expected.begin();
+    for (auto &invocation : invocations) {
+        EXPECT_EQ(invocation.trigger_time, start + it->first);
+        EXPECT_EQ(invocation.now, invocation.trigger_time);
+        ++it;
+    }
+    for (auto &state : states) {
+        EXPECT_FALSE(cancel_deferred_exec_advanced(table.data(), table.size(), state.token)) << "Completed executors should be released";
+    }
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToTrigger) {
+    CallbackState state = {1, 10, INVALID_DEFERRED_TOKEN, nullptr};
+    uint32_t      start = timer_read32();
+    defer(10, &state);
+
+    run_for(35);
+    ASSERT_EQ(invocations.size(), 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(invocations[i].trigger_time, start + 10 * (i + 1));
+    }
+
+    // A late pass runs each executor once, with the original trigger times
+    invocations.clear();
+    advance_time(30);
+    deferred_exec_advanced_task(table.data(), table.size(), &last_execution);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_EQ(invocations[0].trigger_time, start + 40);
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[1].trigger_time, start + 50);
+}
+
+TEST_F(DeferredExec, ExtendAndCancel) {
+    CallbackState a     = {1, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState b     = {2, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState c     = {3, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    uint32_t      start = timer_read32();
+    defer(10, &a);
+    defer(20, &b);
+    defer(30, &c);
+
+    EXPECT_TRUE(extend_deferred_exec_advanced(table.data(), table.size(), a.token, 40));
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table.data(), table.size(), b.token));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table.data(), table.size(), b.token));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table.data(), table.size(), b.token, 10));
+
+    run_for(50);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[0].id, 3);
+    EXPECT_EQ(invocations[0].trigger_time, start + 30);
+    EXPECT_EQ(invocations[1].id, 1);
+    EXPECT_EQ(invocations[1].trigger_time, start + 40);
+}
+
+TEST_F(DeferredExec, NextDeadline) {
+    uint32_t deadline = 0;
+    EXPECT_FALSE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+
+    CallbackState a     = {1, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState b     = {2, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    uint32_t      start = timer_read32();
+    defer(25, &a);
+    EXPECT_TRUE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+    EXPECT_EQ(deadline, start + 25);
+    defer(15, &b);
+    EXPECT_TRUE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+    EXPECT_EQ(deadline, start + 15);
+
+    // Extending the earliest executor moves the deadline to the next one
+    EXPECT_TRUE(extend_deferred_exec_advanced(table.data(), table.size(), b.token, 40));
+    EXPECT_TRUE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+    EXPECT_EQ(deadline, start + 25);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table.data(), table.size(), a.token));
+    EXPECT_TRUE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+    EXPECT_EQ(deadline, start + 40);
+
+    run_for(40);
+    ASSERT_EQ(invocations.size(), 1);
+    EXPECT_FALSE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+
+    defer(5, &a);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table.data(), table.size(), a.token));
+    EXPECT_FALSE(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline));
+}
+
+TEST_F(DeferredExec, LatePassRunsEachExecutorOnce) {
+    CallbackState a     = {1, 10, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState b     = {2, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    uint32_t      start = timer_read32();
+    defer(10, &a);
+    defer(25, &b);
+
+    // The repeating executor is still behind after running, but mustn't run again or hold up the other one
+    advance_time(30);
+    deferred_exec_advanced_task(table.data(), table.size(), &last_execution);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[0].id, 1);
+    EXPECT_EQ(invocations[0].trigger_time, start + 10);
+    EXPECT_EQ(invocations[1].id, 2);
+    EXPECT_EQ(invocations[1].trigger_time, start + 25);
+
+    // It then catches up one trigger per pass
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 3);
+    EXPECT_EQ(invocations[2].trigger_time, start + 20);
+    run_for(1);
+    ASSERT_EQ(invocations.size(), 4);
+    EXPECT_EQ(invocations[3].trigger_time, start + 30);
+    run_for(1);
+    EXPECT_EQ(invocations.size(), 4);
+}
+
+TEST_F(DeferredExec, TableFull) {
+    std::array<CallbackState, 65> states{};
+    for (int i = 0; i < 64; i++) {
+        states[i] = {i, 0, INVALID_DEFERRED_TOKEN, nullptr};
+        EXPECT_NE(defer(100, &states[i]), INVALID_DEFERRED_TOKEN);
+    }
+    states[64] = {64, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    EXPECT_EQ(defer(100, &states[64]), INVALID_DEFERRED_TOKEN);
+
+    // Tokens are unique, and freed slots are reused with a different token
+    std::vector<deferred_token> tokens;
+    for (int i = 0; i < 64; i++) {
+        tokens.push_back(states[i].token);
+    }
+    std::sort(tokens.begin(), tokens.end());
+    EXPECT_EQ(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
+    deferred_token old_token = states[10].token;
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table.data(), table.size(), old_token));
+    EXPECT_NE(defer(100, &states[64]), INVALID_DEFERRED_TOKEN);
+    EXPECT_NE(states[64].token, old_token);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table.data(), table.size(), old_token));
+}
+
+TEST_F(DeferredExec, CallbackModifiesTable) {
+    CallbackState a = {1, 5, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState b = {2, 5, INVALID_DEFERRED_TOKEN, nullptr};
+    CallbackState c = {3, 0, INVALID_DEFERRED_TOKEN, nullptr};
+    defer(10, &a);
+    defer(10, &b);
+
+    // Whichever runs first cancels the other and itself, then queues a new executor
+    a.action = [&]() {
+        cancel_deferred_exec_advanced(table.data(), table.size(), b.token);
+        cancel_deferred_exec_advanced(table.data(), table.size(), a.token);
+        defer(1, &c);
+    };
+    b.action = a.action;
+
+    run_for(20);
+    ASSERT_EQ(invocations.size(), 2);
+    EXPECT_EQ(invocations[1].id, 3);
+    run_for(20);
+    EXPECT_EQ(invocations.size(), 2);
+}
+
+TEST_F(DeferredExec, LargeTableTokensChangeOnReuse) {
+    // Only the first 127 entries are used, so that every slot has more than one token generation
+    std::array<deferred_executor_t, 255> large_table{};
+    std::array<CallbackState, 128>       states{};
+    for (int i = 0; i < 127; i++) {
+        states[i] = {i, 0, INVALID_DEFERRED_TOKEN, nullptr};
+        EXPECT_NE(defer_exec_advanced(large_table.data(), large_table.size(), 100, record_callback, &states[i]), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec_advanced(large_table.data(), large_table.size(), 100, record_callback, &states[127]), INVALID_DEFERRED_TOKEN);
+
+    for (int i = 0; i < 127; i++) {
+        deferred_token old_token = large_table[i].token;
+        EXPECT_TRUE(cancel_deferred_exec_advanced(large_table.data(), large_table.size(), old_token));
+        deferred_token new_token = defer_exec_advanced(large_table.data(), large_table.size(), 100, record_callback, &states[i]);
+        EXPECT_NE(new_token, INVALID_DEFERRED_TOKEN);
+        EXPECT_NE(new_token, old_token);
+        EXPECT_FALSE(cancel_deferred_exec_advanced(large_table.data(), large_table.size(), old_token));
+    }
+}
+
+TEST_F(DeferredExec, RandomisedAgainstReference) {
+    std::mt19937                  rng(2);
+    std::array<CallbackState, 64> states{};
+    std::map<int, uint32_t>       reference; // state index to trigger time
+
+    for (int step = 0; step < 20000; step++) {
+        int            i     = rng() % 64;
+        CallbackState *state = &states[i];
+        switch (rng() % 4) {
+            case 0:
+                if (!reference.count(i)) {
+                    uint32_t delay = 1 + rng() % 200;
+                    *state         = {i, 0, INVALID_DEFERRED_TOKEN, nullptr};
+                    ASSERT_NE(defer(delay, state), INVALID_DEFERRED_TOKEN);
+                    reference[i] = timer_read32() + delay;
+                }
+                break;
+            case 1:
+                if (reference.count(i)) {
+                    uint32_t delay = 1 + rng() % 200;
+                    ASSERT_TRUE(extend_deferred_exec_advanced(table.data(), table.size(), state->token, delay));
+                    reference[i] = timer_read32() + delay;
+                }
+                break;
+            case 2:
+                // Tokens of completed executors are eventually reused, so only cancel live ones
+                ASSERT_EQ(cancel_deferred_exec_advanced(table.data(), table.size(), state->token), reference.erase(i) == 1);
+                state->token = INVALID_DEFERRED_TOKEN;
+                break;
+            case 3: {
+                invocations.clear();
+                run_for(1 + rng() % 20);
+                for (auto &invocation : invocations) {
+                    ASSERT_EQ(reference.count(invocation.id), 1);
+                    ASSERT_EQ(reference[invocation.id], invocation.trigger_time);
+                    reference.erase(invocation.id);
+                    states[invocation.id].token = INVALID_DEFERRED_TOKEN;
+                }
+                for (auto &entry : reference) {
+                    ASSERT_GT((int32_t)(entry.second - timer_read32()), 0) << "Executor " << entry.first << " was not run";
+                }
+            } break;
+        }
+
+        uint32_t deadline;
+        ASSERT_EQ(deferred_exec_advanced_next_deadline(table.data(), table.size(), &deadline), !reference.empty());
+        if (!reference.empty()) {
+            uint32_t now      = timer_read32();
+            uint32_t earliest = std::min_element(reference.begin(), reference.end(), [now](auto &a, auto &b) { return a.second - now < b.second - now; })->second;
+            ASSERT_EQ(deadline, earliest);
+        }
+    }
+}
@@ -18,6 +18,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
@@ -42,6 +43,7 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
+    layer_switch_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -80,6 +82,7 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+    layer_switch_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -167,5 +170,9 @@ void dynamic_keymap_macro_send(uint8_t id) {
     }
 
     send_string_nvm_state_t state = {.offset = offset};
+#ifdef SEND_STRING_ASYNC_ENABLE
+    send_string_async_with_delay_impl(send_string_get_next_nvm, &state, sizeof(state), DYNAMIC_KEYMAP_MACRO_DELAY);
+#else
     send_string_with_delay_impl(send_string_get_next_nvm, &state, DYNAMIC_KEYMAP_MACRO_DELAY);
+#endif
 }
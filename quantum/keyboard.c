@@ -32,6 +32,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
+#include "profiler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -71,6 +73,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef COMBO_ENABLE
 #    include "process_combo.h"
 #endif
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "send_string.h"
+#endif
 #ifdef TAP_DANCE_ENABLE
 #    include "process_tap_dance.h"
 #endif
@@ -110,6 +115,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#ifdef WEAR_LEVELING_ENABLE
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -610,7 +618,12 @@ static bool matrix_task(void) {
     }
 
     const bool process_keypress = should_process_keypress();
+#ifdef LATENCY_TRACE_ENABLE
+    const uint32_t trace_time = latency_trace_edge();
+#endif
 
+    // Keys changing in the same scan result in a single keyboard report
+    keyboard_report_begin();
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -625,7 +638,13 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef LATENCY_TRACE_ENABLE
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+                    latency_trace_start(&event.trace, trace_time);
+                    action_exec(event);
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
@@ -634,6 +653,7 @@ static bool matrix_task(void) {
 
         matrix_previous[row] = current_row;
     }
+    keyboard_report_commit();
 
     return matrix_changed;
 }
@@ -673,7 +693,7 @@ void quantum_task(void) {
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    PROFILER_CALL("key_override_task", key_override_task());
 #endif
 
 #ifdef SEQUENCER_ENABLE
@@ -681,11 +701,15 @@ void quantum_task(void) {
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    PROFILER_CALL("tap_dance_task", tap_dance_task());
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    PROFILER_CALL("combo_task", combo_task());
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+    send_string_task();
 #endif
 
 #ifdef LEADER_ENABLE
@@ -720,12 +744,18 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_task();
+#endif
+    PROFILER_BEGIN(matrix_task);
+    const bool matrix_changed = matrix_task();
+    PROFILER_END(matrix_task);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILER_CALL("quantum_task", quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -739,7 +769,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILER_CALL("rgb_matrix_task", rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -756,7 +786,10 @@ void keyboard_task(void) {
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    PROFILER_BEGIN(pointing_device_task);
+    const bool pointing_device_changed = pointing_device_task();
+    PROFILER_END(pointing_device_task);
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
@@ -812,4 +845,8 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef WEAR_LEVELING_ENABLE
+    wear_leveling_task();
+#endif
 }
@@ -0,0 +1,208 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#    include "chibios_config.h"
+#    define LATENCY_TRACE_TIMESTAMP() chSysGetRealtimeCounterX()
+#    define LATENCY_TRACE_TICKS_TO_US(ticks) ((ticks) / (REALTIME_COUNTER_CLOCK / 1000000UL))
+#    define LATENCY_TRACE_RESOLUTION_US 1
+#else
+// No microsecond timer available, latencies are rounded to whole milliseconds
+#    include "timer.h"
+#    define LATENCY_TRACE_TIMESTAMP() timer_read32()
+#    define LATENCY_TRACE_TICKS_TO_US(ticks) ((ticks) * 1000UL)
+#    define LATENCY_TRACE_RESOLUTION_US 1000
+#endif
+
+#define LATENCY_TRACE_PENDING_MARK (1 << LATENCY_TRACE_STAGE_COUNT)
+
+static latency_trace_stats_t stats[LATENCY_TRACE_STAGE_COUNT];
+
+static latency_trace_t pending[LATENCY_TRACE_PENDING];
+static uint8_t         pending_count = 0;
+
+static uint32_t raw_change_time = 0;
+static bool     raw_change      = false;
+
+static uint8_t latency_trace_bucket(uint32_t us) {
+    uint8_t bucket = 0;
+    while (us) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket < LATENCY_TRACE_HISTOGRAM_BUCKETS ? bucket : LATENCY_TRACE_HISTOGRAM_BUCKETS - 1;
+}
+
+static void latency_trace_record(latency_trace_stage_t stage, uint32_t ticks) {
+    latency_trace_stats_t *s  = &stats[stage];
+    uint32_t               us = LATENCY_TRACE_TICKS_TO_US(ticks);
+
+    if (s->count == 0 || us < s->min) {
+        s->min = us;
+    }
+    if (us > s->max) {
+        s->max = us;
+    }
+    s->count++;
+    s->total += us;
+    uint16_t *bucket = &s->histogram[latency_trace_bucket(us)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+void latency_trace_raw_change(void) {
+    // Keep the first change, later ones are the same key bouncing or other keys that will be debounced alongside
+    if (!raw_change) {
+        raw_change_time = LATENCY_TRACE_TIMESTAMP();
+        raw_change      = true;
+    }
+}
+
+void latency_trace_raw_settled(void) {
+    // The raw change never became an edge, so a later one must not be timed from it
+    raw_change = false;
+}
+
+uint32_t latency_trace_edge(void) {
+    uint32_t now = LATENCY_TRACE_TIMESTAMP();
+    if (raw_change) {
+        latency_trace_record(LATENCY_TRACE_DEBOUNCE, now - raw_change_time);
+        raw_change = false;
+    }
+    return now;
+}
+
+void latency_trace_start(latency_trace_t *trace, uint32_t timestamp) {
+    trace->edge  = timestamp;
+    trace->last  = timestamp;
+    trace->marks = 1 << LATENCY_TRACE_DEBOUNCE;
+}
+
+void latency_trace_mark(latency_trace_t *trace, latency_trace_stage_t stage) {
+    if (!trace->marks || (trace->marks & (1 << stage))) {
+        return;
+    }
+    uint32_t now = LATENCY_TRACE_TIMESTAMP();
+    latency_trace_record(stage, now - trace->last);
+    trace->last = now;
+    trace->marks |= 1 << stage;
+}
+
+void latency_trace_process(latency_trace_t *trace) {
+    if (!trace->marks || (trace->marks & LATENCY_TRACE_PENDING_MARK)) {
+        return;
+    }
+    // Without tapping or combos the earlier stages take no time
+    latency_trace_mark(trace, LATENCY_TRACE_COMBO);
+    latency_trace_mark(trace, LATENCY_TRACE_TAPPING);
+    trace->marks |= LATENCY_TRACE_PENDING_MARK;
+    if (pending_count < LATENCY_TRACE_PENDING) {
+        pending[pending_count++] = *trace;
+    }
+}
+
+void latency_trace_report(void) {
+    uint32_t now = LATENCY_TRACE_TIMESTAMP();
+    for (uint8_t i = 0; i < pending_count; i++) {
+        latency_trace_record(LATENCY_TRACE_PROCESS, now - pending[i].last);
+        latency_trace_record(LATENCY_TRACE_TOTAL, now - pending[i].edge);
+    }
+    pending_count = 0;
+}
+
+void latency_trace_task(void) {
+    pending_count = 0;
+}
+
+const latency_trace_stats_t *latency_trace_get_stats(latency_trace_stage_t stage) {
+    return stage < LATENCY_TRACE_STAGE_COUNT ? &stats[stage] : NULL;
+}
+
+uint32_t latency_trace_percentile(latency_trace_stage_t stage, uint8_t percent) {
+    const latency_trace_stats_t *s = &stats[stage];
+    if (s->count == 0) {
+        return 0;
+    }
+
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < LATENCY_TRACE_HISTOGRAM_BUCKETS; i++) {
+        samples += s->histogram[i];
+    }
+    uint32_t target = (samples * percent + 99) / 100;
+    uint32_t seen   = 0;
+    for (uint8_t i = 0; i < LATENCY_TRACE_HISTOGRAM_BUCKETS; i++) {
+        seen += s->histogram[i];
+        if (seen >= target) {
+            // Bucket i holds latencies of bit length i, i.e. up to 2^i - 1 microseconds
+            uint32_t upper = (i == LATENCY_TRACE_HISTOGRAM_BUCKETS - 1 || i >= 32) ? UINT32_MAX : ((1UL << i) - 1);
+            return upper < s->max ? upper : s->max;
+        }
+    }
+    return s->max;
+}
+
+void latency_trace_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    pending_count = 0;
+    raw_change    = false;
+}
+
+static void put_le(uint8_t *data, uint64_t value, uint8_t size) {
+    for (uint8_t i = 0; i < size; i++) {
+        data[i] = value >> (8 * i);
+    }
+}
+
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 32 || data[0] != LATENCY_TRACE_RAW_HID_ID) {
+        return false;
+    }
+
+    uint8_t command = data[1];
+    uint8_t stage   = data[2];
+    uint8_t first   = data[3];
+    memset(data + 2, 0, length - 2);
+
+    switch (command) {
+        case LATENCY_TRACE_GET_INFO:
+            // [id, command, stage count, bucket count, resolution in microseconds (u16)]
+            data[2] = LATENCY_TRACE_STAGE_COUNT;
+            data[3] = LATENCY_TRACE_HISTOGRAM_BUCKETS;
+            put_le(data + 4, LATENCY_TRACE_RESOLUTION_US, 2);
+            return true;
+        case LATENCY_TRACE_GET_STAGE:
+            // [id, command, stage, count (u32), min (u32), max (u32), total (u64)]
+            if (stage < LATENCY_TRACE_STAGE_COUNT) {
+                data[2] = stage;
+                put_le(data + 3, stats[stage].count, 4);
+                put_le(data + 7, stats[stage].min, 4);
+                put_le(data + 11, stats[stage].max, 4);
+                put_le(data + 15, stats[stage].total, 8);
+                return true;
+            }
+            break;
+        case LATENCY_TRACE_GET_HISTOGRAM:
+            // [id, command, stage, first bucket, up to 14 buckets (u16)]
+            if (stage < LATENCY_TRACE_STAGE_COUNT) {
+                data[2] = stage;
+                data[3] = first;
+                for (uint8_t i = 0; first + i < LATENCY_TRACE_HISTOGRAM_BUCKETS && 4 + 2 * (i + 1) <= length; i++) {
+                    put_le(data + 4 + 2 * i, stats[stage].histogram[first + i], 2);
+                }
+                return true;
+            }
+            break;
+        case LATENCY_TRACE_RESET:
+            latency_trace_reset();
+            return true;
+    }
+
+    // Same marker VIA uses for commands it does not know
+    data[1] = 0xFF;
+    return true;
+}
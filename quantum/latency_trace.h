@@ -0,0 +1,104 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Keypress latency tracer, enabled with `LATENCY_TRACE_ENABLE = yes` in rules.mk.
+
+    Each key event is stamped when matrix_task() sees its edge, and the stamp
+    travels with the event through combos, the tap-hold waiting buffer and
+    process_record() until the keyboard report it causes is queued. The time
+    spent in each stage is collected into a power-of-two histogram, which can
+    be read back over raw HID with latency_trace_raw_hid_receive().
+*/
+
+/** \brief Number of power-of-two histogram buckets kept per stage, the last one collects everything longer. */
+#ifndef LATENCY_TRACE_HISTOGRAM_BUCKETS
+#    define LATENCY_TRACE_HISTOGRAM_BUCKETS 16
+#endif
+
+/** \brief Number of processed events that can wait for a report within a single keyboard_task(). */
+#ifndef LATENCY_TRACE_PENDING
+#    define LATENCY_TRACE_PENDING 8
+#endif
+
+/** \brief First byte of the raw HID packets handled by latency_trace_raw_hid_receive(). */
+#ifndef LATENCY_TRACE_RAW_HID_ID
+#    define LATENCY_TRACE_RAW_HID_ID 0xC7
+#endif
+
+typedef enum {
+    LATENCY_TRACE_DEBOUNCE, // first raw matrix change to the debounced edge
+    LATENCY_TRACE_COMBO,    // edge to leaving combo processing
+    LATENCY_TRACE_TAPPING,  // leaving combo processing to process_record(), i.e. the tap-hold waiting buffer
+    LATENCY_TRACE_PROCESS,  // process_record() to the keyboard report being queued
+    LATENCY_TRACE_TOTAL,    // edge to the keyboard report being queued
+    LATENCY_TRACE_STAGE_COUNT,
+} latency_trace_stage_t;
+
+enum latency_trace_raw_hid_command {
+    LATENCY_TRACE_GET_INFO      = 0x00,
+    LATENCY_TRACE_GET_STAGE     = 0x01,
+    LATENCY_TRACE_GET_HISTOGRAM = 0x02,
+    LATENCY_TRACE_RESET         = 0x03,
+};
+
+/** \brief Trace carried by a key event, `marks` is zero for events that are not traced. */
+typedef struct {
+    uint32_t edge;  // timestamp of the edge
+    uint32_t last;  // timestamp of the last completed stage
+    uint8_t  marks; // bit per stage already recorded
+} latency_trace_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;   // microseconds
+    uint32_t max;   // microseconds
+    uint64_t total; // microseconds
+    uint16_t histogram[LATENCY_TRACE_HISTOGRAM_BUCKETS];
+} latency_trace_stats_t;
+
+/** \brief Notes a change of the raw, not yet debounced, matrix. */
+void latency_trace_raw_change(void);
+
+/** \brief Notes that the debounced matrix matches the raw matrix again without an edge, e.g. after a bounce. */
+void latency_trace_raw_settled(void);
+
+/** \brief Records the debounce stage for a scan that produced edges, returning the timestamp for their events. */
+uint32_t latency_trace_edge(void);
+
+/** \brief Starts tracing an event created at `timestamp`. */
+void latency_trace_start(latency_trace_t *trace, uint32_t timestamp);
+
+/** \brief Records the time since the previous stage of `trace`, once per stage. */
+void latency_trace_mark(latency_trace_t *trace, latency_trace_stage_t stage);
+
+/** \brief Marks `trace` as processed, its remaining stages complete with the next keyboard report. */
+void latency_trace_process(latency_trace_t *trace);
+
+/** \brief Completes the processed events with the keyboard report that was just queued. */
+void latency_trace_report(void);
+
+/** \brief Drops processed events that did not result in a keyboard report. */
+void latency_trace_task(void);
+
+const latency_trace_stats_t *latency_trace_get_stats(latency_trace_stage_t stage);
+
+/**
+ * \brief Upper bound of the latency below which `percent` of the samples of `stage` fall, in microseconds.
+ *
+ * Resolution is limited to the power-of-two histogram buckets, the result is clamped to the observed maximum.
+ */
+uint32_t latency_trace_percentile(latency_trace_stage_t stage, uint8_t percent);
+
+void latency_trace_reset(void);
+
+/**
+ * \brief Handles a raw HID packet starting with LATENCY_TRACE_RAW_HID_ID, replacing it with the response.
+ *
+ * \return true if the packet was a latency trace command and the response should be sent back.
+ */
+bool latency_trace_raw_hid_receive(uint8_t *data, uint8_t length);
@@ -21,6 +21,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+#ifdef MATRIX_READ_COLS_BY_PORT
+#    include "matrix_gather.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -163,6 +169,38 @@ static void unselect_rows(void) {
     }
 }
 
+#            ifdef MATRIX_READ_COLS_BY_PORT
+static gpio_port_t     col_ports[MATRIX_COLS];
+static uint8_t         col_port_count = 0;
+static matrix_gather_t col_gather;
+
+static void init_col_gather(void) {
+    uint8_t port[MATRIX_COLS];
+    uint8_t pad[MATRIX_COLS];
+
+    // Assign each distinct port of the col pins a slot, so every port is read only once per row
+    col_port_count = 0;
+    for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        pin_t pin = col_pins[col];
+        if (pin == NO_PIN) {
+            port[col] = MATRIX_GATHER_NO_PORT;
+            continue;
+        }
+
+        uint8_t slot = 0;
+        while (slot < col_port_count && col_ports[slot] != gpio_pin_port(pin)) {
+            slot++;
+        }
+        if (slot == col_port_count) {
+            col_ports[col_port_count++] = gpio_pin_port(pin);
+        }
+        port[col] = slot;
+        pad[col]  = gpio_pin_pad(pin);
+    }
+    matrix_gather_init(&col_gather, port, pad, MATRIX_COLS);
+}
+#            endif // MATRIX_READ_COLS_BY_PORT
+
 __attribute__((weak)) void matrix_init_pins(void) {
     unselect_rows();
     for (uint8_t x = 0; x < MATRIX_COLS; x++) {
@@ -181,6 +219,17 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
     }
     matrix_output_select_delay();
 
+#            ifdef MATRIX_READ_COLS_BY_PORT
+    // Read each port once, with pressed keys as set bits
+    uint32_t port_values[MATRIX_COLS];
+    for (uint8_t slot = 0; slot < col_port_count; slot++) {
+        port_values[slot] = gpio_read_port(col_ports[slot]);
+#                if MATRIX_INPUT_PRESSED_STATE == 0
+        port_values[slot] = ~port_values[slot];
+#                endif
+    }
+    current_row_value = matrix_gather_row(&col_gather, port_values);
+#            else
     // For each col...
     matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
     for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
@@ -189,6 +238,7 @@ __attribute__((weak)) void matrix_read_cols_on_row(matrix_row_t current_matrix[]
         // Populate the matrix row with the state of the col pin
         current_row_value |= pin_state ? 0 : row_shifter;
     }
+#            endif // MATRIX_READ_COLS_BY_PORT
 
     // Unselect row
     unselect_row(current_row);
@@ -302,6 +352,10 @@ void matrix_init(void) {
 
     // initialize key pins
     matrix_init_pins();
+#if defined(MATRIX_READ_COLS_BY_PORT) && !defined(DIRECT_PINS) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS) && (DIODE_DIRECTION == COL2ROW)
+    // Not part of matrix_init_pins(), so keyboards overriding it still read their columns
+    init_col_gather();
+#endif
 
     // initialize matrix state: all keys off
     memset(matrix, 0, sizeof(matrix));
@@ -338,11 +392,21 @@ uint8_t matrix_scan(void) {
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
+#ifdef LATENCY_TRACE_ENABLE
+    if (changed) latency_trace_raw_change();
+#endif
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#    ifdef LATENCY_TRACE_ENABLE
+    if (!changed && memcmp(raw_matrix, matrix + thisHand, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0) latency_trace_raw_settled();
+#    endif
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef LATENCY_TRACE_ENABLE
+    if (!changed && memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0) latency_trace_raw_settled();
+#    endif
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
@@ -3,6 +3,10 @@
 #include "wait.h"
 #include "print.h"
 #include "debug.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include <string.h>
+#    include "latency_trace.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -167,11 +171,21 @@ __attribute__((weak)) void matrix_init(void) {
 
 __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
+#ifdef LATENCY_TRACE_ENABLE
+    if (changed) latency_trace_raw_change();
+#endif
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#    ifdef LATENCY_TRACE_ENABLE
+    if (!changed && memcmp(raw_matrix, matrix + thisHand, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0) latency_trace_raw_settled();
+#    endif
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef LATENCY_TRACE_ENABLE
+    if (!changed && memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0) latency_trace_raw_settled();
+#    endif
     matrix_scan_kb();
 #endif
 
@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "matrix_gather.h"
+
+void matrix_gather_init(matrix_gather_t *gather, const uint8_t port[], const uint8_t pad[], uint8_t count) {
+    matrix_gather_run_t *run   = NULL;
+    uint8_t              width = 0;
+
+    gather->run_count = 0;
+    for (uint8_t col = 0; col < count; col++) {
+        if (port[col] == MATRIX_GATHER_NO_PORT) {
+            run = NULL;
+            continue;
+        }
+
+        // Extend the current run if this pin directly follows its last one
+        if (run && run->port == port[col] && pad[col] == run->shift + width) {
+            width++;
+        } else {
+            run        = &gather->runs[gather->run_count++];
+            run->port  = port[col];
+            run->shift = pad[col];
+            run->col   = col;
+            width      = 1;
+        }
+        run->mask = width >= 32 ? UINT32_MAX : ((1UL << width) - 1);
+    }
+}
+
+matrix_row_t matrix_gather_row(const matrix_gather_t *gather, const uint32_t values[]) {
+    matrix_row_t row = 0;
+
+    for (uint8_t i = 0; i < gather->run_count; i++) {
+        const matrix_gather_run_t *run = &gather->runs[i];
+        row |= (matrix_row_t)((values[run->port] >> run->shift) & run->mask) << run->col;
+    }
+    return row;
+}
@@ -0,0 +1,57 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "matrix.h"
+
+/*
+    Gathers the column bits of a matrix row from whole GPIO port reads.
+
+    Columns that sit on consecutive pads of the same port, in the same
+    order, are combined into a single run and moved into place with one
+    shift and mask. Scattered pins end up as runs of one column each, so
+    any pinout works, it is just faster the more contiguous it is.
+*/
+
+/* Port index of a column without a pin, which is never pressed. */
+#define MATRIX_GATHER_NO_PORT 0xFF
+
+typedef struct {
+    uint32_t mask;  // bits of the run, starting from bit 0
+    uint8_t  port;  // index into the port values
+    uint8_t  shift; // first pad of the run
+    uint8_t  col;   // first column of the run
+} matrix_gather_run_t;
+
+typedef struct {
+    uint8_t             run_count;
+    matrix_gather_run_t runs[MATRIX_COLS];
+} matrix_gather_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Builds the runs for a set of column pins.
+ *
+ * \param gather the tables to fill in
+ * \param port for each column, the index of its port in the values passed to matrix_gather_row(), or MATRIX_GATHER_NO_PORT
+ * \param pad for each column, the bit of its pin within the port
+ * \param count the number of columns
+ */
+void matrix_gather_init(matrix_gather_t *gather, const uint8_t port[], const uint8_t pad[], uint8_t count);
+
+/**
+ * \brief Assembles a matrix row from port values.
+ *
+ * \param gather the tables built by matrix_gather_init()
+ * \param values the value of each port, with a set bit for every pressed key
+ * \return the matrix row, column 0 in bit 0
+ */
+matrix_row_t matrix_gather_row(const matrix_gather_t *gather, const uint32_t values[]);
+
+#ifdef __cplusplus
+}
+#endif
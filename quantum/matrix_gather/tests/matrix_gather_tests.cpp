@@ -0,0 +1,103 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix_gather.h"
+}
+
+struct col_pin {
+    uint8_t port;
+    uint8_t pad;
+};
+
+#define NONE \
+    { MATRIX_GATHER_NO_PORT, 0 }
+
+/* Same result as reading every col pin on its own, as matrix_read_cols_on_row() does without MATRIX_READ_COLS_BY_PORT. */
+static matrix_row_t read_per_pin(const std::vector<col_pin> &pins, const uint32_t values[]) {
+    matrix_row_t row         = 0;
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (const auto &pin : pins) {
+        if (pin.port != MATRIX_GATHER_NO_PORT && (values[pin.port] >> pin.pad) & 1) {
+            row |= row_shifter;
+        }
+        row_shifter <<= 1;
+    }
+    return row;
+}
+
+static matrix_gather_t build(const std::vector<col_pin> &pins) {
+    uint8_t port[MATRIX_COLS];
+    uint8_t pad[MATRIX_COLS];
+    for (size_t i = 0; i < pins.size(); i++) {
+        port[i] = pins[i].port;
+        pad[i]  = pins[i].pad;
+    }
+    matrix_gather_t gather;
+    matrix_gather_init(&gather, port, pad, pins.size());
+    return gather;
+}
+
+static void expect_same_as_per_pin(const std::vector<col_pin> &pins) {
+    matrix_gather_t gather = build(pins);
+    std::mt19937    rng(1234);
+
+    for (int i = 0; i < 1000; i++) {
+        uint32_t values[3] = {(uint32_t)rng(), (uint32_t)rng(), (uint32_t)rng()};
+        ASSERT_EQ(matrix_gather_row(&gather, values), read_per_pin(pins, values)) << "port values " << std::hex << values[0] << " " << values[1] << " " << values[2];
+    }
+
+    uint32_t all[3] = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    EXPECT_EQ(matrix_gather_row(&gather, all), read_per_pin(pins, all));
+    uint32_t none[3] = {0, 0, 0};
+    EXPECT_EQ(matrix_gather_row(&gather, none), 0);
+}
+
+TEST(MatrixGather, ContiguousPinsFormOneRun) {
+    std::vector<col_pin> pins;
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        pins.push_back({0, (uint8_t)(i + 3)});
+    }
+    EXPECT_EQ(build(pins).run_count, 1);
+    expect_same_as_per_pin(pins);
+}
+
+TEST(MatrixGather, RunsSplitOnPortAndPadChanges) {
+    std::vector<col_pin> pins = {{0, 0}, {0, 1}, {0, 2}, {1, 3}, {1, 4}, {0, 3}, {0, 5}, {0, 6}, {2, 31}, {2, 30}};
+    EXPECT_EQ(build(pins).run_count, 6);
+    expect_same_as_per_pin(pins);
+}
+
+TEST(MatrixGather, ReversedPinsFallBackToSingleColumns) {
+    std::vector<col_pin> pins;
+    for (uint8_t i = 0; i < 8; i++) {
+        pins.push_back({1, (uint8_t)(7 - i)});
+    }
+    EXPECT_EQ(build(pins).run_count, 8);
+    expect_same_as_per_pin(pins);
+}
+
+TEST(MatrixGather, ColumnsWithoutPinsAreNeverPressed) {
+    std::vector<col_pin> pins = {{0, 0}, NONE, {0, 1}, {0, 2}, NONE, NONE, {2, 8}};
+    EXPECT_EQ(build(pins).run_count, 3);
+    expect_same_as_per_pin(pins);
+}
+
+TEST(MatrixGather, ScatteredPins) {
+    std::mt19937         rng(42);
+    std::vector<col_pin> pins;
+    for (uint8_t i = 0; i < MATRIX_COLS; i++) {
+        pins.push_back({(uint8_t)(rng() % 3), (uint8_t)(rng() % 32)});
+    }
+    expect_same_as_per_pin(pins);
+}
+
+TEST(MatrixGather, FullWidthPort) {
+    std::vector<col_pin> pins = {{0, 12}, {0, 13}, {0, 14}, {0, 15}, {0, 16}, {0, 17}, {0, 18}, {0, 19}, {0, 20}, {0, 21}, {0, 22}, {0, 23}, {0, 24}, {0, 25}, {0, 26}, {0, 27}, {0, 28}, {0, 29}, {0, 30}, {0, 31}};
+    EXPECT_EQ(build(pins).run_count, 1);
+    expect_same_as_per_pin(pins);
+}
@@ -0,0 +1,5 @@
+matrix_gather_DEFS := -DMATRIX_ROWS=1 -DMATRIX_COLS=20
+
+matrix_gather_SRC := \
+    $(QUANTUM_PATH)/matrix_gather/tests/matrix_gather_tests.cpp \
+    $(QUANTUM_PATH)/matrix_gather.c
@@ -56,6 +56,33 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of unicode glyph lookups that each loaded font remembers, keyed by code point. Glyphs
+ *      outside of the ASCII table are otherwise located by binary search of the font's unicode table on every draw.
+ *      Each entry requires 12 bytes of RAM per font. Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_ATLAS_SIZE
+/**
+ * @def This controls the size, in bytes, of the glyph atlas. Recently drawn glyphs are kept in the atlas already
+ *      converted to the display's native pixel format, keyed by device, font, code point and colors, so redrawing the
+ *      same text sends them straight to the display without reading the font or converting colors. The least recently
+ *      used glyphs are evicted when it is full. Defaults to 0, which disables the atlas.
+ */
+#    define QUANTUM_PAINTER_GLYPH_ATLAS_SIZE 0
+#endif
+
+#ifndef QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES
+/**
+ * @def This controls the maximum number of glyphs held by the glyph atlas, regardless of their size. Each entry
+ *      requires 32 bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES 32
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +99,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+/**
+ * @def This controls whether a second pixel data buffer is allocated, so that images and fonts can decode the next
+ *      block of pixel data while the previous one is still being transmitted. Only comms drivers capable of
+ *      non-blocking transfers make use of it. Requires another \ref QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
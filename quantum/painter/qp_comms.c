@@ -33,6 +33,7 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+    qp_comms_pipeline_end(device);
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,15 +44,62 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+    qp_comms_wait(device);
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (driver->comms_pipelined) {
+        // Only one transfer in flight, the previous one has to complete before the next can start
+        driver->comms_vtable->comms_wait(device);
+        return driver->comms_vtable->comms_send_async(device, data, byte_count);
+    }
+
+    return driver->comms_vtable->comms_send(device, data, byte_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pipelined comms APIs
+
+bool qp_comms_pipeline_begin(painter_device_t device) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver && driver->validate_ok && driver->comms_vtable->comms_send_async && driver->comms_vtable->comms_wait) {
+        driver->comms_pipelined = true;
+        return true;
+    }
+#endif
+    return false;
+}
+
+void qp_comms_pipeline_end(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver && driver->comms_pipelined) {
+        driver->comms_vtable->comms_wait(device);
+        driver->comms_pipelined = false;
+    }
+}
+
+void qp_comms_wait(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (driver && driver->comms_pipelined) {
+        driver->comms_vtable->comms_wait(device);
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
 void qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +116,6 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 void qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t *                   driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait(device);
     comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
@@ -16,6 +16,21 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pipelined comms APIs
+
+// Until qp_comms_pipeline_end() or qp_comms_stop(), qp_comms_send_async() returns as soon as the transfer has started.
+// Returns false if the comms driver can't send without blocking, or QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER is disabled,
+// in which case qp_comms_send_async() keeps blocking.
+bool qp_comms_pipeline_begin(painter_device_t device);
+void qp_comms_pipeline_end(painter_device_t device);
+
+// Sends data which the caller leaves untouched until the next send, or until qp_comms_wait() returns
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+
+// Waits for the transfer in flight, if any
+void qp_comms_wait(painter_device_t device);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -18,6 +18,13 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 // Returns the number of pixels that can fit in the pixdata buffer
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device);
 
+// Returns the pixdata buffer the codecs decode into. With QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER, this alternates between
+// two buffers so that one can be filled while the other is being transmitted, otherwise it's always the global buffer.
+uint8_t* qp_internal_pixdata_buffer(void);
+
+// Moves on to the other pixdata buffer once the current one has been handed to the driver, returning it
+uint8_t* qp_internal_swap_pixdata_buffers(void);
+
 // Fills the supplied buffer with equivalent native pixels matching the supplied HSV
 void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint8_t hue, uint8_t sat, uint8_t val);
 
@@ -28,14 +35,20 @@ bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y);
 bool qp_internal_fillrect_helper_impl(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b);
 
 // Convert from input pixel data + palette to equivalent pixels
+// Decoded palette indices are handed to the pixel output callback in runs of up to this many pixels -- a multiple of the 32 pixels held by a word at 1bpp
+#define QP_INTERNAL_DECODE_BATCH_SIZE 32
 typedef int16_t (*qp_internal_byte_input_callback)(void* cb_arg);
-typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+typedef bool (*qp_internal_pixel_output_callback)(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
 typedef bool (*qp_internal_byte_output_callback)(uint8_t byte, void* cb_arg);
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg);
 bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_callback output_callback, void* output_arg);
 
+// Converts a run of palette indices to native pixels, for use by drivers' append_pixels implementations
+void qp_internal_palette_to_rgb565(uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices);
+void qp_internal_palette_to_rgb888(uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices);
+
 // Global variable used for interpolated pixel lookup table.
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 extern qp_pixel_t qp_internal_global_pixel_lookup_table[256];
@@ -76,25 +89,39 @@ typedef struct qp_internal_byte_input_state_t {
     };
 } qp_internal_byte_input_state_t;
 
+// Viewport of the pixel data being decoded. It's only set right before the first block is sent, so that decoding can
+// start while the transfer of a previous draw is still in flight.
+typedef struct qp_internal_pending_viewport_t {
+    bool     pending;
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} qp_internal_pending_viewport_t;
+
 typedef struct qp_internal_pixel_output_state_t {
-    painter_device_t device;
-    uint32_t         pixel_write_pos;
-    uint32_t         max_pixels;
+    painter_device_t                device;
+    uint32_t                        pixel_write_pos;
+    uint32_t                        max_pixels;
+    uint8_t*                        buffer;
+    qp_internal_pending_viewport_t* viewport;
 } qp_internal_pixel_output_state_t;
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg);
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg);
 
 typedef struct qp_internal_byte_output_state_t {
-    painter_device_t device;
-    uint32_t         byte_write_pos;
-    uint32_t         max_bytes;
+    painter_device_t                device;
+    uint32_t                        byte_write_pos;
+    uint32_t                        max_bytes;
+    uint8_t*                        buffer;
+    qp_internal_pending_viewport_t* viewport;
 } qp_internal_byte_output_state_t;
 
 bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg);
 
-// Helper shared between image and font rendering, sends pixels to the display using:
+// Helper shared between image and font rendering, sends pixels to the viewport l/t/r/b of the display using:
 //     - qp_internal_decode_palette + qp_internal_pixel_appender (bpp <= 8)
 //     - qp_internal_send_bytes                                  (bpp > 8)
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
+bool qp_internal_appender(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state);
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression);
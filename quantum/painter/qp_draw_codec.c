@@ -31,21 +31,37 @@ bool qp_internal_bpp_capable(uint8_t bits_per_pixel) {
 
 bool qp_internal_decode_palette(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_callback output_callback, void* output_arg) {
     const uint8_t pixel_bitmask    = (1 << bits_per_pixel) - 1;
-    const uint8_t pixels_per_byte  = 8 / bits_per_pixel;
+    const uint8_t pixels_per_word  = 32 / bits_per_pixel;
     uint32_t      remaining_pixels = pixel_count; // don't try to derive from byte_count, we may not use an entire byte
+    uint8_t       batch[QP_INTERNAL_DECODE_BATCH_SIZE];
+    uint8_t       batch_pixels     = 0;
     while (remaining_pixels > 0) {
-        int16_t byteval = input_callback(input_arg);
-        if (byteval < 0) {
-            return false;
+        // Gather up to 32 bits worth of pixels, reading only the bytes that hold them
+        uint8_t  loop_pixels = QP_MIN(remaining_pixels, pixels_per_word);
+        uint8_t  loop_bytes  = (loop_pixels * bits_per_pixel + 7) / 8;
+        uint32_t word        = 0;
+        for (uint8_t b = 0; b < loop_bytes; ++b) {
+            int16_t byteval = input_callback(input_arg);
+            if (byteval < 0) {
+                return false;
+            }
+            word |= ((uint32_t)byteval) << (8 * b);
         }
-        uint8_t loop_pixels = remaining_pixels < pixels_per_byte ? remaining_pixels : pixels_per_byte;
+
+        // Pixels are packed from the least significant bit of each byte
         for (uint8_t q = 0; q < loop_pixels; ++q) {
-            if (!output_callback(palette, byteval & pixel_bitmask, output_arg)) {
+            batch[batch_pixels++] = word & pixel_bitmask;
+            word >>= bits_per_pixel;
+        }
+        remaining_pixels -= loop_pixels;
+
+        // Hand the indices over in runs, rather than one pixel at a time
+        if (batch_pixels == QP_INTERNAL_DECODE_BATCH_SIZE || remaining_pixels == 0) {
+            if (!output_callback(palette, batch, batch_pixels, output_arg)) {
                 return false;
             }
-            byteval >>= bits_per_pixel;
+            batch_pixels = 0;
         }
-        remaining_pixels -= loop_pixels;
     }
     return true;
 }
@@ -81,6 +97,53 @@ bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_int
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Palette index to native pixel conversion, shared by the drivers' append_pixels implementations
+
+void qp_internal_palette_to_rgb565(uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    uint16_t* target = ((uint16_t*)target_buffer) + pixel_offset;
+
+    // Get to a word boundary, then store two pixels at a time
+    if (pixel_count > 0 && ((uintptr_t)target & 2)) {
+        *target++ = palette[*palette_indices++].rgb565;
+        pixel_count--;
+    }
+    for (; pixel_count >= 2; pixel_count -= 2, palette_indices += 2, target += 2) {
+        uint32_t lo = palette[palette_indices[0]].rgb565;
+        uint32_t hi = palette[palette_indices[1]].rgb565;
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        uint32_t pair = (lo << 16) | hi;
+#else
+        uint32_t pair = lo | (hi << 16);
+#endif
+        memcpy(target, &pair, sizeof(pair));
+    }
+    if (pixel_count > 0) {
+        *target = palette[*palette_indices].rgb565;
+    }
+}
+
+void qp_internal_palette_to_rgb888(uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    uint8_t* target = target_buffer + pixel_offset * 3;
+
+#if __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+    // Four pixels make up three words -- the r/g/b bytes of each palette entry are the low 24 bits of its word
+    for (; pixel_count >= 4; pixel_count -= 4, palette_indices += 4, target += 12) {
+        uint32_t a        = palette[palette_indices[0]].dummy & 0xFFFFFF;
+        uint32_t b        = palette[palette_indices[1]].dummy & 0xFFFFFF;
+        uint32_t c        = palette[palette_indices[2]].dummy & 0xFFFFFF;
+        uint32_t d        = palette[palette_indices[3]].dummy & 0xFFFFFF;
+        uint32_t words[3] = {a | (b << 24), (b >> 8) | (c << 16), (c >> 16) | (d << 8)};
+        memcpy(target, words, sizeof(words));
+    }
+#endif
+    for (; pixel_count > 0; pixel_count--, palette_indices++, target += 3) {
+        target[0] = palette[*palette_indices].rgb888.r;
+        target[1] = palette[*palette_indices].rgb888.g;
+        target[2] = palette[*palette_indices].rgb888.b;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Progressive pull of bytes, push of pixels
 
@@ -126,20 +189,48 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
-bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
-    qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
-    painter_driver_t*                 driver = (painter_driver_t*)state->device;
+// Sends a filled pixdata buffer, setting the viewport first if it's still pending, and moves on to the other buffer
+static bool qp_internal_send_pixdata_buffer(painter_device_t device, qp_internal_pending_viewport_t* viewport, uint8_t** buffer, uint32_t native_pixel_count) {
+    painter_driver_t* driver = (painter_driver_t*)device;
 
-    if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, palette, state->pixel_write_pos++, 1, &index)) {
+    if (viewport && viewport->pending) {
+        viewport->pending = false;
+        if (!driver->driver_vtable->viewport(device, viewport->left, viewport->top, viewport->right, viewport->bottom)) {
+            qp_dprintf("qp_internal_send_pixdata_buffer: fail (could not set viewport)\n");
+            return false;
+        }
+    }
+
+    if (!driver->driver_vtable->pixdata(device, *buffer, native_pixel_count)) {
         return false;
     }
 
-    // If we've hit the transmit limit, send out the entire buffer and reset the write position
-    if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+    // If the comms are pipelined, the buffer is still in flight -- decode the next block into the other one
+    *buffer = qp_internal_swap_pixdata_buffers();
+    return true;
+}
+
+bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t* palette_indices, uint32_t pixel_count, void* cb_arg) {
+    qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
+    painter_driver_t*                 driver = (painter_driver_t*)state->device;
+
+    while (pixel_count > 0) {
+        // Append as many pixels as fit in the remainder of the buffer
+        uint32_t run_pixels = QP_MIN(pixel_count, state->max_pixels - state->pixel_write_pos);
+        if (!driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->pixel_write_pos, run_pixels, palette_indices)) {
             return false;
         }
-        state->pixel_write_pos = 0;
+        state->pixel_write_pos += run_pixels;
+        palette_indices += run_pixels;
+        pixel_count -= run_pixels;
+
+        // If we've hit the transmit limit, send out the entire buffer and reset the write position
+        if (state->pixel_write_pos == state->max_pixels) {
+            if (!qp_internal_send_pixdata_buffer(state->device, state->viewport, &state->buffer, state->pixel_write_pos)) {
+                return false;
+            }
+            state->pixel_write_pos = 0;
+        }
     }
 
     return true;
@@ -149,14 +240,13 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     qp_internal_byte_output_state_t* state  = (qp_internal_byte_output_state_t*)cb_arg;
     painter_driver_t*                driver = (painter_driver_t*)state->device;
 
-    if (!driver->driver_vtable->append_pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos++, byteval)) {
+    if (!driver->driver_vtable->append_pixdata(state->device, state->buffer, state->byte_write_pos++, byteval)) {
         return false;
     }
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
-        painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_send_pixdata_buffer(state->device, state->viewport, &state->buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -166,21 +256,22 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
 }
 
 // Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
+bool qp_internal_appender(painter_device_t device, uint16_t l, uint16_t t, uint16_t r, uint16_t b, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
 
-    bool ret = false;
+    bool                           ret      = false;
+    qp_internal_pending_viewport_t viewport = {.pending = true, .left = l, .top = t, .right = r, .bottom = b};
 
     // Non-native pixel format
     if (bpp <= 8) {
         // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
+        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device), .buffer = qp_internal_pixdata_buffer(), .viewport = &viewport};
 
         // Decode the pixel data and stream to the display
         ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_send_pixdata_buffer(device, &viewport, &output_state.buffer, output_state.pixel_write_pos);
         }
     }
 
@@ -190,14 +281,14 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         return false;
     } else {
         // Set up the output state
-        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
+        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8, .buffer = qp_internal_pixdata_buffer(), .viewport = &viewport};
 
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * bpp / 8;
         ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_send_pixdata_buffer(device, &viewport, &output_state.buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
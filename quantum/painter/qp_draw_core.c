@@ -23,6 +23,12 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 // Buffer used for transmitting native pixel data to the downstream device.
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+// Second buffer, filled by the codecs while the other one is still being transmitted.
+__attribute__((__aligned__(4))) static uint8_t qp_internal_global_pixdata_back_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+static bool                                    pixdata_back_buffer_active = false;
+#endif
+
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
 static int16_t                                    generated_steps   = -1;
@@ -42,6 +48,21 @@ uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
 }
 
+uint8_t *qp_internal_pixdata_buffer(void) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    return pixdata_back_buffer_active ? qp_internal_global_pixdata_back_buffer : qp_internal_global_pixdata_buffer;
+#else
+    return qp_internal_global_pixdata_buffer;
+#endif
+}
+
+uint8_t *qp_internal_swap_pixdata_buffers(void) {
+#if QUANTUM_PAINTER_PIXDATA_DOUBLE_BUFFER
+    pixdata_back_buffer_active = !pixdata_back_buffer_active;
+#endif
+    return qp_internal_pixdata_buffer();
+}
+
 // qp_setpixel internal implementation, but accepts a buffer with pre-converted native pixel. Only the first pixel is used.
 bool qp_internal_setpixel_impl(painter_device_t device, uint16_t x, uint16_t y) {
     painter_driver_t *driver = (painter_driver_t *)device;
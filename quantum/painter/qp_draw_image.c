@@ -233,6 +233,9 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    // Decode the next block of pixels while the previous one is transmitted, if the comms driver is able to
+    qp_comms_pipeline_begin(device);
+
     uint16_t l, t, r, b;
     if (frame_info->is_delta) {
         l = x + frame_info->left;
@@ -247,13 +250,6 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     }
     uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
-    // Configure where we're going to be rendering to
-    if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
-        return false;
-    }
-
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
@@ -263,8 +259,8 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
-    // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    // Decode and stream pixels, setting the viewport once the first block is ready
+    bool ret = qp_internal_appender(device, l, t, r, b, frame_info->bpp, pixel_count, input_callback, &input_state);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -12,6 +12,14 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t value;     // as per qff_unicode_glyph_v1_t
+    uint16_t last_used; // zero if the entry is unused
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
@@ -32,10 +40,133 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    uint16_t                glyph_cache_clock;
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE];
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+STATIC_ASSERT(QUANTUM_PAINTER_GLYPH_ATLAS_SIZE <= UINT16_MAX, "QUANTUM_PAINTER_GLYPH_ATLAS_SIZE must be at most 65535 bytes");
+
+typedef struct qp_glyph_atlas_entry_t {
+    painter_device_t   device;
+    qff_font_handle_t *font;
+    uint32_t           code_point;
+    uint32_t           fg;        // hsv888, zero for fonts with their own palette
+    uint32_t           bg;        // hsv888, zero for fonts with their own palette
+    uint32_t           last_used; // zero if the entry is unused
+    uint16_t           offset;    // location of the glyph's native pixel data within the arena
+    uint16_t           size;
+    uint8_t            width;
+} qp_glyph_atlas_entry_t;
+
+// Glyphs' native pixel data, packed at the start of the arena in no particular order
+__attribute__((__aligned__(4))) static uint8_t glyph_atlas[QUANTUM_PAINTER_GLYPH_ATLAS_SIZE];
+static uint16_t                                glyph_atlas_used  = 0;
+static uint32_t                                glyph_atlas_clock = 0;
+static qp_glyph_atlas_entry_t                  glyph_atlas_entries[QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES];
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph atlas
+
+static inline uint32_t qp_glyph_atlas_tick(void) {
+    // Restart the usage ordering if the clock is about to wrap
+    if (glyph_atlas_clock == UINT32_MAX) {
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES; ++i) {
+            if (glyph_atlas_entries[i].last_used != 0) {
+                glyph_atlas_entries[i].last_used = 1;
+            }
+        }
+        glyph_atlas_clock = 1;
+    }
+    return ++glyph_atlas_clock;
+}
+
+static inline qp_glyph_atlas_entry_t *qp_glyph_atlas_find(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, uint32_t fg, uint32_t bg) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES; ++i) {
+        qp_glyph_atlas_entry_t *entry = &glyph_atlas_entries[i];
+        if (entry->last_used != 0 && entry->code_point == code_point && entry->font == qff_font && entry->device == device && entry->fg == fg && entry->bg == bg) {
+            entry->last_used = qp_glyph_atlas_tick();
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void qp_glyph_atlas_evict(qp_glyph_atlas_entry_t *victim) {
+    // Compact the arena, so that its free space is always at the end
+    uint16_t end = victim->offset + victim->size;
+    memmove(&glyph_atlas[victim->offset], &glyph_atlas[end], glyph_atlas_used - end);
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES; ++i) {
+        qp_glyph_atlas_entry_t *entry = &glyph_atlas_entries[i];
+        if (entry->last_used != 0 && entry->offset > victim->offset) {
+            entry->offset -= victim->size;
+        }
+    }
+    glyph_atlas_used -= victim->size;
+    victim->last_used = 0;
+}
+
+static qp_glyph_atlas_entry_t *qp_glyph_atlas_alloc(painter_device_t device, qff_font_handle_t *qff_font, uint32_t code_point, uint32_t fg, uint32_t bg, uint8_t width) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+
+    // Rounded up to a whole number of words, so every glyph's pixel data stays aligned for the driver's appenders
+    uint32_t size = (((uint32_t)width * qff_font->base.line_height * driver->native_bits_per_pixel + 31) / 32) * 4;
+    if (size > QUANTUM_PAINTER_GLYPH_ATLAS_SIZE) {
+        return NULL;
+    }
+
+    // Evict the least recently used glyphs until there's both a free entry and enough room
+    qp_glyph_atlas_entry_t *entry;
+    while (true) {
+        qp_glyph_atlas_entry_t *victim = NULL;
+        entry                          = NULL;
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES; ++i) {
+            qp_glyph_atlas_entry_t *candidate = &glyph_atlas_entries[i];
+            if (candidate->last_used == 0) {
+                entry = entry ? entry : candidate;
+            } else if (!victim || candidate->last_used < victim->last_used) {
+                victim = candidate;
+            }
+        }
+
+        if (entry && glyph_atlas_used + size <= QUANTUM_PAINTER_GLYPH_ATLAS_SIZE) {
+            break;
+        }
+
+        // A glyph still being transmitted may be moved while compacting
+        qp_comms_wait(device);
+        qp_glyph_atlas_evict(victim);
+    }
+
+    entry->device     = device;
+    entry->font       = qff_font;
+    entry->code_point = code_point;
+    entry->fg         = fg;
+    entry->bg         = bg;
+    entry->offset     = glyph_atlas_used;
+    entry->size       = size;
+    entry->width      = width;
+    entry->last_used  = qp_glyph_atlas_tick();
+    glyph_atlas_used += size;
+    return entry;
+}
+
+static void qp_glyph_atlas_forget_font(qff_font_handle_t *qff_font) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_GLYPH_ATLAS_ENTRIES; ++i) {
+        qp_glyph_atlas_entry_t *entry = &glyph_atlas_entries[i];
+        if (entry->last_used != 0 && entry->font == qff_font) {
+            qp_glyph_atlas_evict(entry);
+        }
+    }
+}
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -106,6 +237,12 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs from a previously-loaded font in this slot
+    memset(font->glyph_cache, 0, sizeof(font->glyph_cache));
+    font->glyph_cache_clock = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -151,6 +288,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+    // Drop any glyphs rendered from this font, the slot may be reused for another one
+    qp_glyph_atlas_forget_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -163,6 +305,9 @@ bool qp_close_font(painter_font_handle_t font) {
 // Callback to be invoked for each codepoint detected in the UTF8 input string
 typedef bool (*code_point_handler)(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg);
 
+// Optional callback invoked for each codepoint before its glyph is located in the font, setting handled if there's nothing left to do
+typedef bool (*code_point_lookup)(qff_font_handle_t *qff_font, uint32_t code_point, bool *handled, void *cb_arg);
+
 // Helper that sets up the palette (if required) and returns the offset in the stream that the data starts
 static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device, qff_font_handle_t *qff_font, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, uint32_t *data_offset) {
     painter_driver_t *driver = (painter_driver_t *)device;
@@ -214,6 +359,102 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+// Helper that positions the stream at the start of a glyph's pixel data, given its glyph info value
+static inline bool qp_drawtext_seek_glyph_data(qff_font_handle_t *qff_font, uint32_t glyph_value, uint8_t *width) {
+    uint8_t  glyph_width  = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    uint32_t glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+                           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+                           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                           + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+                           + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = glyph_width;
+    return true;
+}
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+static inline bool qp_drawtext_glyph_cache_get(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+    for (uint16_t i = 0; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE; ++i) {
+        qff_glyph_cache_entry_t *entry = &qff_font->glyph_cache[i];
+        if (entry->last_used != 0 && entry->code_point == code_point) {
+            entry->last_used = ++qff_font->glyph_cache_clock;
+            *glyph_value     = entry->value;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline void qp_drawtext_glyph_cache_put(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t glyph_value) {
+    // Restart the usage ordering if the clock is about to wrap
+    if (qff_font->glyph_cache_clock == UINT16_MAX) {
+        memset(qff_font->glyph_cache, 0, sizeof(qff_font->glyph_cache));
+        qff_font->glyph_cache_clock = 0;
+    }
+
+    // Evict the least recently used entry, preferring unused ones
+    qff_glyph_cache_entry_t *victim = &qff_font->glyph_cache[0];
+    for (uint16_t i = 1; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE && victim->last_used != 0; ++i) {
+        if (qff_font->glyph_cache[i].last_used < victim->last_used) {
+            victim = &qff_font->glyph_cache[i];
+        }
+    }
+
+    victim->code_point = code_point;
+    victim->value      = glyph_value;
+    victim->last_used  = ++qff_font->glyph_cache_clock;
+}
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+// Helper that binary searches the unicode table (sorted by code point) for the glyph info of the supplied code point
+static inline bool qp_drawtext_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    if (qp_drawtext_glyph_cache_get(qff_font, code_point, glyph_value)) {
+        return true;
+    }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+    uint32_t table_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+                            + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                            + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+
+    uint16_t lo = 0, hi = qff_font->num_unicode_glyphs;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (qp_stream_setpos(&qff_font->stream, table_offset + mid * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+            qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+            return false;
+        }
+
+        qff_unicode_glyph_v1_t glyph_info;
+        if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+            qp_dprintf("Failed to read unicode glyph info\n");
+            return false;
+        }
+
+        if (glyph_info.code_point == code_point) {
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+            qp_drawtext_glyph_cache_put(qff_font, code_point, glyph_info.value);
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+            *glyph_value = glyph_info.value;
+            return true;
+        } else if (glyph_info.code_point < code_point) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return false;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
@@ -231,69 +472,22 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_info.value, width);
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        uint32_t glyph_value;
+        if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &glyph_value)) {
+            qp_dprintf("Failed to find unicode glyph info\n");
             return false;
         }
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
-                return false;
-            }
-
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
-        }
-
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_value, width);
     }
     return false;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
-static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
+static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_lookup lookup, code_point_handler handler, void *cb_arg) {
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -302,6 +496,15 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
             return false;
         }
 
+        bool handled = false;
+        if (lookup && !lookup(qff_font, code_point, &handled, cb_arg)) {
+            qp_dprintf("Failed to execute glyph lookup.\n");
+            return false;
+        }
+        if (handled) {
+            continue;
+        }
+
         uint8_t width;
         if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
@@ -342,31 +545,126 @@ typedef struct code_point_iter_drawglyph_state_t {
     painter_device_t                  device;
     int16_t                           xpos;
     int16_t                           ypos;
+    qp_pixel_t                        fg_hsv888;
+    qp_pixel_t                        bg_hsv888;
+    bool                              palette_ready;
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+    uint32_t atlas_fg;
+    uint32_t atlas_bg;
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
 } code_point_iter_drawglyph_state_t;
 
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+// Output state used while decoding a glyph into the atlas
+typedef struct qp_glyph_atlas_output_state_t {
+    painter_device_t device;
+    uint8_t *        target;
+    uint32_t         pixel_write_pos;
+} qp_glyph_atlas_output_state_t;
+
+static bool qp_glyph_atlas_pixel_appender(qp_pixel_t *palette, uint8_t *palette_indices, uint32_t pixel_count, void *cb_arg) {
+    qp_glyph_atlas_output_state_t *state  = (qp_glyph_atlas_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    uint32_t                       offset = state->pixel_write_pos;
+    state->pixel_write_pos += pixel_count;
+    return driver->driver_vtable->append_pixels(state->device, state->target, palette, offset, pixel_count, palette_indices);
+}
+
+// Draws a glyph held by the atlas at the current position, straight from its native pixel data
+static bool qp_drawtext_draw_atlas_glyph(code_point_iter_drawglyph_state_t *state, qp_glyph_atlas_entry_t *entry) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+
+    uint16_t l = state->xpos;
+    uint16_t t = state->ypos;
+    uint16_t r = state->xpos + entry->width - 1;
+    uint16_t b = state->ypos + entry->font->base.line_height - 1;
+    state->xpos += entry->width;
+
+    if (!driver->driver_vtable->viewport(state->device, l, t, r, b)) {
+        qp_dprintf("qp_drawtext_draw_atlas_glyph: fail (could not set viewport)\n");
+        return false;
+    }
+
+    // Send in blocks no larger than the pixdata buffer, as drivers expect
+    const uint8_t *pixel_data  = &glyph_atlas[entry->offset];
+    uint32_t       pixel_count = (uint32_t)entry->width * entry->font->base.line_height;
+    uint32_t       max_pixels  = qp_internal_num_pixels_in_buffer(state->device);
+    while (pixel_count > 0) {
+        uint32_t block_pixels = QP_MIN(pixel_count, max_pixels);
+        if (!driver->driver_vtable->pixdata(state->device, pixel_data, block_pixels)) {
+            return false;
+        }
+        pixel_data += block_pixels * driver->native_bits_per_pixel / 8;
+        pixel_count -= block_pixels;
+    }
+    return true;
+}
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
+// Codepoint lookup callback: drawing
+static inline bool qp_font_code_point_lookup_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, bool *handled, void *cb_arg) {
+    code_point_iter_drawglyph_state_t *state = (code_point_iter_drawglyph_state_t *)cb_arg;
+
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+    // Glyphs already in the atlas need neither the font's data nor the palette
+    qp_glyph_atlas_entry_t *entry = qp_glyph_atlas_find(state->device, qff_font, code_point, state->atlas_fg, state->atlas_bg);
+    if (entry) {
+        *handled = true;
+        return qp_drawtext_draw_atlas_glyph(state, entry);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
+    // Set up the palette on the first glyph needing to be decoded, before the stream is positioned at its data
+    if (!state->palette_ready) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
+            return false;
+        }
+        state->palette_ready = true;
+    }
+
+    return true;
+}
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
-    code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
-    painter_driver_t *                 driver = (painter_driver_t *)state->device;
+    code_point_iter_drawglyph_state_t *state = (code_point_iter_drawglyph_state_t *)cb_arg;
 
     // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+    // Decode palette-based glyphs into the atlas, then draw them from there
+    qp_glyph_atlas_entry_t *entry = qff_font->bpp <= 8 ? qp_glyph_atlas_alloc(state->device, qff_font, code_point, state->atlas_fg, state->atlas_bg, width) : NULL;
+    if (entry) {
+        qp_glyph_atlas_output_state_t atlas_output_state = {.device = state->device, .target = &glyph_atlas[entry->offset], .pixel_write_pos = 0};
+        if (!qp_internal_decode_palette(state->device, ((uint32_t)width) * height, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_atlas_pixel_appender, &atlas_output_state)) {
+            qp_glyph_atlas_evict(entry);
+            return false;
+        }
+        return qp_drawtext_draw_atlas_glyph(state, entry);
+    }
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+
     // Reset the output state
     state->output_state->pixel_write_pos = 0;
 
-    // Configure where we're going to be rendering to
-    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+    // Configure where we're going to be rendering to, the viewport is set once the glyph is decoded
+    uint16_t l = state->xpos;
+    uint16_t t = state->ypos;
+    uint16_t r = state->xpos + width - 1;
+    uint16_t b = state->ypos + height - 1;
 
     // Move the x-position for the next glyph
     state->xpos += width;
 
     // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+    return qp_internal_appender(state->device, l, t, r, b, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,7 +680,7 @@ int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
     // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    return qp_iterate_code_points(qff_font, str, NULL, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +714,9 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return 0;
     }
 
+    // Decode the next glyph while the previous one is transmitted, if the comms driver is able to
+    qp_comms_pipeline_begin(device);
+
     // Set up the byte input state and input callback
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
@@ -428,28 +729,31 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
     // Set up the pixel output state
     qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
-    // Set up the codepoint iteration state
+    // Set up the codepoint iteration state, the palette is set up once a glyph needs decoding
     code_point_iter_drawglyph_state_t state = {// Common
                                                .device = device,
                                                .xpos   = x,
                                                .ypos   = y,
+                                               // Colors
+                                               .fg_hsv888     = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}},
+                                               .bg_hsv888     = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}},
+                                               .palette_ready = false,
                                                // Input
                                                .input_callback = input_callback,
                                                .input_state    = &input_state,
                                                // Output
                                                .output_state = &output_state};
 
-    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
+#if QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
+    // Fonts with their own palette render the same regardless of the requested colors
+    if (!qff_font->has_palette) {
+        state.atlas_fg = ((uint32_t)hue_fg << 16) | ((uint32_t)sat_fg << 8) | val_fg;
+        state.atlas_bg = ((uint32_t)hue_bg << 16) | ((uint32_t)sat_bg << 8) | val_bg;
     }
+#endif // QUANTUM_PAINTER_GLYPH_ATLAS_SIZE > 0
 
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    // Iterate the codepoints with the drawglyph callbacks
+    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_lookup_drawglyph, qp_font_code_point_handler_drawglyph, &state);
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -38,12 +38,18 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef void (*painter_driver_comms_wait_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional non-blocking transfers: comms_send_async starts sending and returns straight away, the data needs to stay
+    // untouched until comms_wait returns. Only one transfer is ever in flight.
+    painter_driver_comms_send_func comms_send_async;
+    painter_driver_comms_wait_func comms_wait;
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
@@ -81,6 +87,9 @@ typedef struct painter_driver_t {
 
     // Comms config pointer -- needs to point to an appropriate comms config if the comms driver requires it.
     void *comms_config;
+
+    // Whether data is currently sent without waiting for it to complete, see qp_comms_pipeline_begin()
+    bool comms_pipelined;
 } painter_driver_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
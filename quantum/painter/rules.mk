@@ -21,7 +21,8 @@ VALID_QUANTUM_PAINTER_DRIVERS := \
     sh1107_i2c \
     sh1107_spi \
     ld7032_i2c \
-    ld7032_spi
+    ld7032_spi \
+    host
 
 #-------------------------------------------------------------------------------
 
@@ -232,6 +233,18 @@ define handle_quantum_painter_driver
             $(DRIVER_PATH)/painter/oled_panel/qp_oled_panel.c \
             $(DRIVER_PATH)/painter/ld7032/qp_ld7032.c
 
+    else ifeq ($$(strip $$(CURRENT_PAINTER_DRIVER)),host)
+        # Host only, renders into memory for tests and benchmarks
+        ifneq ($$(strip $$(PLATFORM_KEY)),test)
+            $$(call CATASTROPHIC_ERROR,Invalid QUANTUM_PAINTER_DRIVERS,The host Quantum Painter driver is only available for tests)
+        endif
+        QUANTUM_PAINTER_NEEDS_COMMS_DUMMY := yes
+        OPT_DEFS += -DQUANTUM_PAINTER_HOST_ENABLE
+        COMMON_VPATH += \
+            $(PLATFORM_PATH)/test/drivers
+        SRC += \
+            $(PLATFORM_PATH)/test/drivers/qp_host.c
+
     endif
 endef
 
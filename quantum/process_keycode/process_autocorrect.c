@@ -19,9 +19,154 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+#ifndef AUTOCORRECT_LINK_SIZE
+#    define AUTOCORRECT_LINK_SIZE 2
+#endif
+
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+#    ifdef FLASH_ENABLE
+#        include "flash.h"
+#    endif
+
+#    ifndef AUTOCORRECT_EXTERNAL_ADDRESS
+#        define AUTOCORRECT_EXTERNAL_ADDRESS 0
+#    endif
+
+#    ifndef AUTOCORRECT_CACHE_PAGE_SIZE
+#        ifdef AUTOCORRECT_DICTIONARY_PAGE_SIZE
+#            define AUTOCORRECT_CACHE_PAGE_SIZE AUTOCORRECT_DICTIONARY_PAGE_SIZE
+#        else
+#            define AUTOCORRECT_CACHE_PAGE_SIZE 256
+#        endif
+#    endif
+
+#    ifndef AUTOCORRECT_CACHE_PAGES
+#        define AUTOCORRECT_CACHE_PAGES 4
+#    endif
+
+// The external dictionary starts with "QKAC" and the little endian size of the trie that follows
+#    define AUTOCORRECT_EXTERNAL_HEADER_SIZE 8
+
+typedef uint32_t autocorrect_offset_t;
+
+typedef struct {
+    uint32_t page; // page index + 1, 0 while the entry is unused
+    uint8_t  data[AUTOCORRECT_CACHE_PAGE_SIZE];
+} autocorrect_cache_page_t;
+
+static autocorrect_cache_page_t cache_pages[AUTOCORRECT_CACHE_PAGES];
+// Indices into cache_pages, most recently used first
+static uint8_t cache_order[AUTOCORRECT_CACHE_PAGES];
+
+static enum {
+    DICTIONARY_UNCHECKED,
+    DICTIONARY_VALID,
+    DICTIONARY_INVALID,
+} dictionary_state = DICTIONARY_UNCHECKED;
+
+#    ifdef FLASH_ENABLE
+/**
+ * @brief reads part of the external dictionary, by default from the flash driver
+ *
+ * @param address offset from the start of the dictionary, including its header
+ * @param data buffer to read into
+ * @param length number of bytes to read
+ * @return true read successful
+ * @return false read failed
+ */
+__attribute__((weak)) bool autocorrect_dictionary_read(uint32_t address, void *data, size_t length) {
+    static bool flash_initialised = false;
+    if (!flash_initialised) {
+        flash_init();
+        flash_initialised = true;
+    }
+    return flash_read_range(AUTOCORRECT_EXTERNAL_ADDRESS + address, data, length) == FLASH_STATUS_SUCCESS;
+}
+#    endif
+
+/**
+ * @brief checks the header of the external dictionary on first use
+ *
+ * A missing or outdated dictionary disables lookups rather than walking garbage.
+ *
+ * @return true dictionary can be used
+ */
+static bool autocorrect_dictionary_ready(void) {
+    if (dictionary_state == DICTIONARY_UNCHECKED) {
+        uint8_t header[AUTOCORRECT_EXTERNAL_HEADER_SIZE];
+        if (!autocorrect_dictionary_read(0, header, sizeof(header))) {
+            return false;
+        }
+        uint32_t size    = header[4] | (uint32_t)header[5] << 8 | (uint32_t)header[6] << 16 | (uint32_t)header[7] << 24;
+        dictionary_state = (memcmp(header, "QKAC", 4) == 0 && size == DICTIONARY_SIZE) ? DICTIONARY_VALID : DICTIONARY_INVALID;
+        for (uint8_t i = 0; i < AUTOCORRECT_CACHE_PAGES; ++i) {
+            cache_pages[i].page = 0;
+            cache_order[i]      = i;
+        }
+    }
+    return dictionary_state == DICTIONARY_VALID;
+}
+
+/**
+ * @brief reads a byte of the trie through the page cache
+ *
+ * A failed read returns 0, which ends any walk through the trie, and forces the
+ * header to be checked again before the next lookup.
+ *
+ * @param offset offset into the trie
+ * @return uint8_t byte at offset
+ */
+static uint8_t autocorrect_read_byte(autocorrect_offset_t offset) {
+    if (offset >= DICTIONARY_SIZE) {
+        return 0;
+    }
+
+    uint32_t page = offset / AUTOCORRECT_CACHE_PAGE_SIZE + 1;
+
+    uint8_t i = 0;
+    while (i < AUTOCORRECT_CACHE_PAGES - 1 && cache_pages[cache_order[i]].page != page) {
+        ++i;
+    }
+    uint8_t entry = cache_order[i];
+    // Move the entry to the front, on a miss this evicts the least recently used page
+    memmove(cache_order + 1, cache_order, i);
+    cache_order[0] = entry;
+
+    if (cache_pages[entry].page != page) {
+        uint32_t start  = (page - 1) * AUTOCORRECT_CACHE_PAGE_SIZE;
+        uint32_t length = DICTIONARY_SIZE - start < AUTOCORRECT_CACHE_PAGE_SIZE ? DICTIONARY_SIZE - start : AUTOCORRECT_CACHE_PAGE_SIZE;
+        if (!autocorrect_dictionary_read(AUTOCORRECT_EXTERNAL_HEADER_SIZE + start, cache_pages[entry].data, length)) {
+            cache_pages[entry].page = 0;
+            dictionary_state        = DICTIONARY_UNCHECKED;
+            return 0;
+        }
+        cache_pages[entry].page = page;
+    }
+    return cache_pages[entry].data[offset % AUTOCORRECT_CACHE_PAGE_SIZE];
+}
+#else
+typedef uint16_t autocorrect_offset_t;
+
+#    define autocorrect_read_byte(offset) pgm_read_byte(autocorrect_data + (offset))
+#endif
+
+/**
+ * @brief reads a little endian node link from the trie
+ *
+ * @param offset offset of the link
+ * @return autocorrect_offset_t offset of the linked node
+ */
+static autocorrect_offset_t autocorrect_read_link(autocorrect_offset_t offset) {
+    autocorrect_offset_t link = 0;
+    for (uint8_t i = 0; i < AUTOCORRECT_LINK_SIZE; ++i) {
+        link |= (autocorrect_offset_t)autocorrect_read_byte(offset + i) << (8 * i);
+    }
+    return link;
+}
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -38,6 +183,10 @@ bool autocorrect_is_enabled(void) {
  */
 void autocorrect_enable(void) {
     keymap_config.autocorrect_enable = true;
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+    // Pick up a dictionary written to external flash since the last check
+    dictionary_state = DICTIONARY_UNCHECKED;
+#endif
     eeconfig_update_keymap(&keymap_config);
 }
 
@@ -58,6 +207,10 @@ void autocorrect_disable(void) {
 void autocorrect_toggle(void) {
     keymap_config.autocorrect_enable = !keymap_config.autocorrect_enable;
     typo_buffer_size                 = 0;
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+    // Pick up a dictionary written to external flash since the last check
+    dictionary_state = DICTIONARY_UNCHECKED;
+#endif
     eeconfig_update_keymap(&keymap_config);
 }
 
@@ -179,7 +332,8 @@ bool process_autocorrect_default_handler(uint16_t *keycode, keyrecord_t *record,
  * @brief handling for when autocorrection has been triggered
  *
  * @param backspaces number of characters to remove
- * @param str pointer to PROGMEM string to replace mistyped seletion with
+ * @param str pointer to PROGMEM string to replace mistyped seletion with, in RAM
+ *            instead when the dictionary is stored externally
  * @param typo the wrong string that triggered a correction
  * @param correct what it would become after the changes
  * @return true apply correction
@@ -279,23 +433,29 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         return true;
     }
 
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+    if (!autocorrect_dictionary_ready()) {
+        return true;
+    }
+#endif
+
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    autocorrect_offset_t state = 0;
+    uint8_t              code  = autocorrect_read_byte(state);
     for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
         uint8_t const key_i = typo_buffer[i];
 
         if (code & 64) { // Check for match in node with multiple children.
             code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+            for (; code != key_i; code = autocorrect_read_byte(state += AUTOCORRECT_LINK_SIZE + 1)) {
                 if (!code) return true;
             }
             // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            state = autocorrect_read_link(state + 1);
             // Check for match in node with single child.
         } else if (code != key_i) {
             return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+        } else if (!(code = autocorrect_read_byte(++state))) {
             ++state;
         }
 
@@ -305,11 +465,24 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
+        code = autocorrect_read_byte(state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
             const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+            // Copy the changes out of the page cache, as sending them may evict their page
+            char changes[AUTOCORRECT_MAX_LENGTH + 10] = {0};
+            for (uint8_t j = 0; j < sizeof(changes) - 1; ++j) {
+                if (!(changes[j] = autocorrect_read_byte(state + 1 + j))) {
+                    break;
+                }
+            }
+            if (dictionary_state != DICTIONARY_VALID) {
+                return true;
+            }
+#else
+            const char *changes = (const char *)(autocorrect_data + state + 1);
+#endif
 
             /* Gather info about the typo'd word
              *
@@ -353,13 +526,21 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
 
             uint8_t offset = space_last ? backspaces : backspaces + 1;
             strcpy(correct, typo);
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+            strcpy(correct + typo_len - offset, changes);
+#else
             strcpy_P(correct + typo_len - offset, changes);
+#endif
 
             if (apply_autocorrect(backspaces, changes, typo, correct)) {
                 for (uint8_t i = 0; i < backspaces; ++i) {
                     tap_code(KC_BSPC);
                 }
+#ifdef AUTOCORRECT_DICTIONARY_EXTERNAL
+                send_string(changes);
+#else
                 send_string_P(changes);
+#endif
             }
 
             if (keycode == KC_SPC) {
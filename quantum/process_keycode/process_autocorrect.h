@@ -8,12 +8,14 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "action.h"
 
 bool process_autocorrect(uint16_t keycode, keyrecord_t *record);
 bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
 bool process_autocorrect_default_handler(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
 bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct);
+bool autocorrect_dictionary_read(uint32_t address, void *data, size_t length);
 
 bool autocorrect_is_enabled(void);
 void autocorrect_enable(void);
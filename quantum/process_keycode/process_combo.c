@@ -16,6 +16,10 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#ifdef COMBO_KEY_INDEX_SIZE
+#    include <stdlib.h>
+#endif
+#include "debug.h"
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -84,6 +88,21 @@ static uint16_t timer = 0;
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
+static bool     combos_touched = false; // set once any combo state may need resetting
+
+#ifdef COMBO_KEY_INDEX_SIZE
+/* Inverted index of keycode -> combo, sorted by keycode and then combo index so
+ * lookups visit candidate combos in the same order as a full linear scan. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_key_index_entry_t;
+static combo_key_index_entry_t combo_key_index[COMBO_KEY_INDEX_SIZE];
+static uint16_t                combo_key_index_count = 0;
+
+typedef enum { COMBO_KEY_INDEX_INVALID, COMBO_KEY_INDEX_VALID, COMBO_KEY_INDEX_OVERFLOW } combo_key_index_state_t;
+static combo_key_index_state_t combo_key_index_state = COMBO_KEY_INDEX_INVALID;
+#endif
 
 typedef struct {
     keyrecord_t record;
@@ -202,6 +221,10 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+    if (!combos_touched) {
+        return;
+    }
+    combos_touched = false;
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
@@ -264,7 +287,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -432,6 +454,8 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
         return COMBO_KEY_NOT_PRESSED;
     }
 
+    combos_touched = true;
+
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -551,9 +575,66 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_KEY_INDEX_SIZE
+static int combo_key_index_compare(const void *a, const void *b) {
+    const combo_key_index_entry_t *ea = (const combo_key_index_entry_t *)a;
+    const combo_key_index_entry_t *eb = (const combo_key_index_entry_t *)b;
+    if (ea->keycode != eb->keycode) {
+        return ea->keycode < eb->keycode ? -1 : 1;
+    }
+    if (ea->combo_index != eb->combo_index) {
+        return ea->combo_index < eb->combo_index ? -1 : 1;
+    }
+    return 0;
+}
+
+static void combo_key_index_build(void) {
+    combo_key_index_count = 0;
+    combo_key_index_state = COMBO_KEY_INDEX_VALID;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t key_i = 0; (key = pgm_read_word(&keys[key_i])) != COMBO_END; ++key_i) {
+            if (combo_key_index_count >= COMBO_KEY_INDEX_SIZE) {
+                dprintf("combo: key index full (COMBO_KEY_INDEX_SIZE=%u), falling back to linear scan\n", COMBO_KEY_INDEX_SIZE);
+                combo_key_index_state = COMBO_KEY_INDEX_OVERFLOW;
+                return;
+            }
+            combo_key_index[combo_key_index_count++] = (combo_key_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+        }
+    }
+
+    qsort(combo_key_index, combo_key_index_count, sizeof(combo_key_index_entry_t), combo_key_index_compare);
+}
+
+/* Returns the position of the first index entry for the keycode, or
+ * combo_key_index_count if no combo contains it. */
+static uint16_t combo_key_index_find(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_key_index_count;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
+void combo_key_index_invalidate(void) {
+#ifdef COMBO_KEY_INDEX_SIZE
+    combo_key_index_state = COMBO_KEY_INDEX_INVALID;
+#endif
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -581,10 +662,28 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX_SIZE
+    if (combo_key_index_state == COMBO_KEY_INDEX_INVALID) {
+        combo_key_index_build();
+    }
+
+    if (combo_key_index_state == COMBO_KEY_INDEX_VALID) {
+        uint16_t prev_idx = -1;
+        for (uint16_t pos = combo_key_index_find(keycode); pos < combo_key_index_count && combo_key_index[pos].keycode == keycode; ++pos) {
+            uint16_t idx = combo_key_index[pos].combo_index;
+            if (idx == prev_idx) {
+                // keycode appears more than once in the same combo
+                continue;
+            }
+            prev_idx = idx;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -77,6 +77,9 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+/* Rebuild the keycode index on next use, needed if combo_count() or combo_get() change at runtime. */
+void combo_key_index_invalidate(void);
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
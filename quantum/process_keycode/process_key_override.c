@@ -16,6 +16,9 @@
  */
 
 #include "process_key_override.h"
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX_SIZE
+#    include <stdlib.h>
+#endif
 #include "report.h"
 #include "timer.h"
 #include "debug.h"
@@ -84,6 +87,23 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX_SIZE
+/* Index of trigger keycode -> key override, sorted by trigger and then override index so that lookups visit candidate
+ * overrides in the same order as a full linear scan. The layers and trigger mods are copied so that overrides on other
+ * layers, or requiring mods while none are down, are skipped without fetching them. */
+typedef struct {
+    uint16_t      trigger;
+    uint16_t      override_index;
+    layer_state_t layers;
+    uint8_t       trigger_mods;
+} key_override_index_entry_t;
+static key_override_index_entry_t key_override_index[KEY_OVERRIDE_TRIGGER_INDEX_SIZE];
+static uint16_t                   key_override_index_count = 0;
+
+typedef enum { KEY_OVERRIDE_INDEX_INVALID, KEY_OVERRIDE_INDEX_VALID, KEY_OVERRIDE_INDEX_OVERFLOW } key_override_index_state_t;
+static key_override_index_state_t key_override_index_state = KEY_OVERRIDE_INDEX_INVALID;
+#endif
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -243,150 +263,271 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Tries activating the provided override for the key event. Returns true if it was activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating_single_override(const key_override_t *override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
+
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    key_override_printf("Activating override\n");
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    clear_active_override(false);
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        key_override_printf("Activating override\n");
+    set_suppressed_override_mods(override->suppressed_mods);
 
-        clear_active_override(false);
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
+
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
+    return true;
+}
+
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX_SIZE
+static int key_override_index_compare(const void *a, const void *b) {
+    const key_override_index_entry_t *ea = (const key_override_index_entry_t *)a;
+    const key_override_index_entry_t *eb = (const key_override_index_entry_t *)b;
+    if (ea->trigger != eb->trigger) {
+        return ea->trigger < eb->trigger ? -1 : 1;
+    }
+    if (ea->override_index != eb->override_index) {
+        return ea->override_index < eb->override_index ? -1 : 1;
+    }
+    return 0;
+}
+
+static void key_override_index_build(void) {
+    key_override_index_count = 0;
+    key_override_index_state = KEY_OVERRIDE_INDEX_VALID;
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+        if (key_override_index_count >= KEY_OVERRIDE_TRIGGER_INDEX_SIZE) {
+            dprintf("key override: trigger index full (KEY_OVERRIDE_TRIGGER_INDEX_SIZE=%u), falling back to linear scan\n", KEY_OVERRIDE_TRIGGER_INDEX_SIZE);
+            key_override_index_state = KEY_OVERRIDE_INDEX_OVERFLOW;
+            return;
+        }
+        key_override_index[key_override_index_count++] = (key_override_index_entry_t){
+            .trigger        = override->trigger,
+            .override_index = i,
+            .layers         = override->layers,
+            .trigger_mods   = override->trigger_mods,
+        };
+    }
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+    qsort(key_override_index, key_override_index_count, sizeof(key_override_index_entry_t), key_override_index_compare);
+}
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+/* Returns the position of the first index entry for the trigger, or key_override_index_count if no override uses it. */
+static uint16_t key_override_index_find(uint16_t trigger) {
+    uint16_t lo = 0, hi = key_override_index_count;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (key_override_index[mid].trigger < trigger) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
+    }
+    return lo;
+}
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+static uint16_t key_override_index_end(uint16_t pos, uint16_t trigger) {
+    while (pos < key_override_index_count && key_override_index[pos].trigger == trigger) {
+        pos++;
+    }
+    return pos;
+}
+#endif
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
-                }
+void key_override_trigger_index_invalidate(void) {
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX_SIZE
+    key_override_index_state = KEY_OVERRIDE_INDEX_INVALID;
+#endif
+}
+
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    bool send_key_action = true;
+
+    *activated = false;
+
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+#ifdef KEY_OVERRIDE_TRIGGER_INDEX_SIZE
+    if (key_override_index_state == KEY_OVERRIDE_INDEX_INVALID) {
+        key_override_index_build();
+    }
+
+    if (key_override_index_state == KEY_OVERRIDE_INDEX_VALID) {
+        // An override can only activate if its trigger is KC_NO, was just pressed, or is the last non-mod key pressed
+        const uint16_t triggers[] = {KC_NO, key_down ? keycode : KC_NO, last_key_down};
+        uint16_t       pos[3], end[3];
+        for (uint8_t t = 0; t < 3; t++) {
+            bool duplicate = false;
+            for (uint8_t u = 0; u < t; u++) {
+                duplicate |= triggers[u] == triggers[t];
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
+            pos[t] = duplicate ? 0 : key_override_index_find(triggers[t]);
+            end[t] = duplicate ? 0 : key_override_index_end(pos[t], triggers[t]);
         }
 
-        *activated = true;
+        // Merge the candidate lists in override index order
+        while (true) {
+            int8_t next = -1;
+            for (uint8_t t = 0; t < 3; t++) {
+                if (pos[t] < end[t] && (next < 0 || key_override_index[pos[t]].override_index < key_override_index[pos[next]].override_index)) {
+                    next = t;
+                }
+            }
+            if (next < 0) {
+                break;
+            }
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+            const key_override_index_entry_t *entry = &key_override_index[pos[next]++];
+            if ((entry->layers & (1 << layer)) == 0 || (active_mods == 0 && entry->trigger_mods != 0)) {
+                continue;
+            }
+            if (try_activating_single_override(key_override_get(entry->override_index), keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+                *activated = true;
+                return send_key_action;
+            }
+        }
+        return true;
     }
+#endif
 
-    *activated = false;
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        if (try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            return send_key_action;
+        }
+    }
 
     return true;
 }
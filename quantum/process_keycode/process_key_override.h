@@ -105,6 +105,9 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/** Rebuild the trigger index on next use. The index holds a copy of each override's trigger, layers and trigger_mods, so this is needed whenever any of those change at runtime, as well as when key_override_count() or key_override_get() start returning different overrides. */
+void key_override_trigger_index_invalidate(void);
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
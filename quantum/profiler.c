@@ -0,0 +1,183 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiler.h"
+#include "print.h"
+
+#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+#    include <avr/io.h>
+#elif defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#else
+#    include "timer.h"
+#endif
+
+/* Same cycle counters as basic_profiling.h used; anything else falls back to the millisecond timer. */
+#ifndef PROFILER_TIMESTAMP_GETTER
+#    if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
+#        define PROFILER_TIMESTAMP_GETTER TCNT0
+#        define PROFILER_TIMESTAMP_MASK 0xFFUL
+#    elif defined(PROTOCOL_CHIBIOS)
+#        define PROFILER_TIMESTAMP_GETTER chSysGetRealtimeCounterX()
+#    else
+#        define PROFILER_TIMESTAMP_GETTER timer_read32()
+#    endif
+#endif
+
+#ifndef PROFILER_TIMESTAMP_MASK
+#    define PROFILER_TIMESTAMP_MASK 0xFFFFFFFFUL
+#endif
+
+typedef struct {
+    profiler_probe_t *probe;
+    uint32_t          start;
+    uint32_t          children;
+} profiler_frame_t;
+
+static profiler_probe_t  *probe_list = NULL;
+static profiler_probe_t **probe_tail = &probe_list;
+
+static profiler_frame_t frames[PROFILER_MAX_DEPTH];
+static uint8_t          frame_count = 0;
+static uint8_t          frame_overflow = 0;
+
+static uint8_t profiler_bucket(uint32_t ticks) {
+    uint8_t bucket = 0;
+    while (ticks) {
+        ticks >>= 1;
+        bucket++;
+    }
+    return bucket < PROFILER_HISTOGRAM_BUCKETS ? bucket : PROFILER_HISTOGRAM_BUCKETS - 1;
+}
+
+static void profiler_register(profiler_probe_t *probe) {
+    probe->registered = true;
+    probe->next       = NULL;
+    probe->parent     = frame_count ? frames[frame_count - 1].probe : NULL;
+    probe->depth      = frame_count;
+    probe->min        = UINT32_MAX;
+    *probe_tail       = probe;
+    probe_tail        = &probe->next;
+}
+
+static void profiler_record(profiler_probe_t *probe, uint32_t elapsed, uint32_t self) {
+    probe->count++;
+    probe->total += elapsed;
+    probe->self += self;
+    if (elapsed < probe->min) {
+        probe->min = elapsed;
+    }
+    if (elapsed > probe->max) {
+        probe->max = elapsed;
+    }
+    uint16_t *bucket = &probe->histogram[profiler_bucket(elapsed)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+void profiler_probe_begin(profiler_probe_t *probe) {
+    if (frame_count >= PROFILER_MAX_DEPTH) {
+        frame_overflow++;
+        return;
+    }
+    if (!probe->registered) {
+        profiler_register(probe);
+    }
+
+    profiler_frame_t *frame = &frames[frame_count++];
+    frame->probe            = probe;
+    frame->children         = 0;
+    // Sample last so that the bookkeeping above is not attributed to the probe
+    frame->start = PROFILER_TIMESTAMP_GETTER;
+}
+
+void profiler_probe_end(profiler_probe_t *probe) {
+    uint32_t now = PROFILER_TIMESTAMP_GETTER;
+
+    if (frame_overflow) {
+        frame_overflow--;
+        return;
+    }
+    // Unbalanced begin/end pairs are dropped rather than corrupting the nesting
+    if (frame_count == 0 || frames[frame_count - 1].probe != probe) {
+        return;
+    }
+
+    profiler_frame_t *frame   = &frames[--frame_count];
+    uint32_t          elapsed = (now - frame->start) & PROFILER_TIMESTAMP_MASK;
+    uint32_t          self    = elapsed > frame->children ? elapsed - frame->children : 0;
+    profiler_record(probe, elapsed, self);
+
+    if (frame_count) {
+        frames[frame_count - 1].children += elapsed;
+    }
+}
+
+uint32_t profiler_probe_percentile(const profiler_probe_t *probe, uint8_t percent) {
+    uint32_t samples = 0;
+    for (uint8_t i = 0; i < PROFILER_HISTOGRAM_BUCKETS; i++) {
+        samples += probe->histogram[i];
+    }
+    if (samples == 0) {
+        return 0;
+    }
+
+    uint32_t target = (samples * percent + 99) / 100;
+    uint32_t seen   = 0;
+    for (uint8_t i = 0; i < PROFILER_HISTOGRAM_BUCKETS; i++) {
+        seen += probe->histogram[i];
+        if (seen >= target) {
+            // Bucket i holds durations of bit length i, i.e. up to 2^i - 1 ticks
+            uint32_t upper = (i == PROFILER_HISTOGRAM_BUCKETS - 1 || i >= 32) ? UINT32_MAX : ((1UL << i) - 1);
+            return upper < probe->max ? upper : probe->max;
+        }
+    }
+    return probe->max;
+}
+
+profiler_probe_t *profiler_find_probe(const char *name) {
+    for (profiler_probe_t *probe = probe_list; probe; probe = probe->next) {
+        if (strcmp(probe->name, name) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+static void profiler_dump_probe(const profiler_probe_t *probe) {
+    for (uint8_t i = 0; i < probe->depth; i++) {
+        xprintf("  ");
+    }
+    if (probe->count == 0) {
+        xprintf("%s: no samples\n", probe->name);
+        return;
+    }
+    xprintf("%s: n=%lu min=%lu avg=%lu p99=%lu max=%lu self=%lu\n", probe->name, (unsigned long)probe->count, (unsigned long)probe->min, (unsigned long)(probe->total / probe->count), (unsigned long)profiler_probe_percentile(probe, 99), (unsigned long)probe->max, (unsigned long)(probe->self / probe->count));
+}
+
+static void profiler_dump_children(const profiler_probe_t *parent) {
+    for (const profiler_probe_t *probe = probe_list; probe; probe = probe->next) {
+        if (probe->parent == parent) {
+            profiler_dump_probe(probe);
+            profiler_dump_children(probe);
+        }
+    }
+}
+
+void profiler_dump(void) {
+    xprintf("profiler (timestamp ticks):\n");
+    profiler_dump_children(NULL);
+}
+
+void profiler_reset(void) {
+    for (profiler_probe_t *probe = probe_list; probe; probe = probe->next) {
+        probe->count = 0;
+        probe->min   = UINT32_MAX;
+        probe->max   = 0;
+        probe->total = 0;
+        probe->self  = 0;
+        memset(probe->histogram, 0, sizeof(probe->histogram));
+    }
+}
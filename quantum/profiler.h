@@ -0,0 +1,119 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Hierarchical profiler, enabled with `PROFILER_ENABLE = yes` in rules.mk.
+    Without it every macro below compiles down to the wrapped code alone.
+
+    Usage example:
+
+        #include "profiler.h"
+
+        // Wrap a statement, discarding any return value:
+        PROFILER_CALL("quantum_task", quantum_task());
+
+        // Wrap an expression, keeping its value:
+        if (PROFILER_EVAL("process_combo", process_combo(keycode, record))) { ... }
+
+        // Wrap a region; begin and end must be balanced within the same block:
+        PROFILER_BEGIN(matrix_task);
+        bool changed = matrix_task();
+        PROFILER_END(matrix_task);
+
+    Probes started while another one is running are recorded as its children.
+    profiler_dump() prints every probe to the console, profiler_reset() clears
+    the statistics; both are also bound to Command (see MAGIC_KEY_PROFILER).
+*/
+
+#ifdef PROFILER_ENABLE
+
+/** \brief Maximum number of probes that can be running at the same time. */
+#    ifndef PROFILER_MAX_DEPTH
+#        define PROFILER_MAX_DEPTH 8
+#    endif
+
+/** \brief Number of power-of-two histogram buckets kept per probe. */
+#    ifndef PROFILER_HISTOGRAM_BUCKETS
+#        define PROFILER_HISTOGRAM_BUCKETS 24
+#    endif
+
+typedef struct profiler_probe_t {
+    const char              *name;
+    struct profiler_probe_t *next;
+    struct profiler_probe_t *parent;
+    bool                     registered;
+    uint8_t                  depth;
+    uint32_t                 count;
+    uint32_t                 min;
+    uint32_t                 max;
+    uint64_t                 total;
+    uint64_t                 self;
+    uint16_t                 histogram[PROFILER_HISTOGRAM_BUCKETS];
+} profiler_probe_t;
+
+void profiler_probe_begin(profiler_probe_t *probe);
+void profiler_probe_end(profiler_probe_t *probe);
+
+/**
+ * \brief Upper bound of the duration below which `percent` of the samples fall, in timestamp ticks.
+ *
+ * Resolution is limited to the power-of-two histogram buckets, the result is clamped to the observed maximum.
+ */
+uint32_t profiler_probe_percentile(const profiler_probe_t *probe, uint8_t percent);
+
+profiler_probe_t *profiler_find_probe(const char *name);
+
+void profiler_dump(void);
+void profiler_reset(void);
+
+#    define PROFILER_PROBE_INIT(probe_name) \
+        { .name = (probe_name) }
+
+#    define PROFILER_BEGIN(id)                                                     \
+        static profiler_probe_t profiler_probe_##id = PROFILER_PROBE_INIT(#id); \
+        profiler_probe_begin(&profiler_probe_##id)
+
+#    define PROFILER_END(id) profiler_probe_end(&profiler_probe_##id)
+
+#    define PROFILER_CALL(name, ...)                                                  \
+        do {                                                                          \
+            static profiler_probe_t profiler_probe_call = PROFILER_PROBE_INIT(name); \
+            profiler_probe_begin(&profiler_probe_call);                               \
+            do {                                                                      \
+                __VA_ARGS__;                                                          \
+            } while (0);                                                              \
+            profiler_probe_end(&profiler_probe_call);                                 \
+        } while (0)
+
+/* Same as PROFILER_CALL(), evaluating to the result of the expression so it can be used inside conditions. */
+#    define PROFILER_EVAL(name, ...)                                                  \
+        ({                                                                            \
+            static profiler_probe_t profiler_probe_eval = PROFILER_PROBE_INIT(name); \
+            profiler_probe_begin(&profiler_probe_eval);                               \
+            __typeof__(__VA_ARGS__) profiler_result = (__VA_ARGS__);                  \
+            profiler_probe_end(&profiler_probe_eval);                                 \
+            profiler_result;                                                          \
+        })
+
+#else
+
+#    define PROFILER_BEGIN(id) \
+        do {                   \
+        } while (0)
+#    define PROFILER_END(id) \
+        do {                 \
+        } while (0)
+#    define PROFILER_CALL(name, ...) \
+        do {                         \
+            __VA_ARGS__;             \
+        } while (0)
+#    define PROFILER_EVAL(name, ...) (__VA_ARGS__)
+
+#    define profiler_dump()
+#    define profiler_reset()
+
+#endif // PROFILER_ENABLE
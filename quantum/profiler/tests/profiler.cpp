@@ -0,0 +1,132 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "profiler.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+/* Timestamps come from the millisecond timer on the test platform, so durations are fully controlled. */
+static void outer_task(uint32_t before, uint32_t inner, uint32_t after) {
+    PROFILER_BEGIN(outer);
+    advance_time(before);
+    PROFILER_CALL("inner", advance_time(inner));
+    advance_time(after);
+    PROFILER_END(outer);
+}
+
+static void leaf_task(uint32_t duration) {
+    PROFILER_CALL("leaf", advance_time(duration));
+}
+
+class Profiler : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        profiler_reset();
+    }
+};
+
+TEST_F(Profiler, RecordsMinMaxAverage) {
+    leaf_task(2);
+    leaf_task(10);
+    leaf_task(6);
+
+    profiler_probe_t *leaf = profiler_find_probe("leaf");
+    ASSERT_NE(leaf, nullptr);
+    EXPECT_EQ(leaf->count, 3);
+    EXPECT_EQ(leaf->min, 2);
+    EXPECT_EQ(leaf->max, 10);
+    EXPECT_EQ(leaf->total / leaf->count, 6);
+    EXPECT_EQ(leaf->parent, nullptr);
+}
+
+TEST_F(Profiler, NestedProbesTrackParentAndSelfTime) {
+    outer_task(3, 5, 2);
+
+    profiler_probe_t *outer = profiler_find_probe("outer");
+    profiler_probe_t *inner = profiler_find_probe("inner");
+    ASSERT_NE(outer, nullptr);
+    ASSERT_NE(inner, nullptr);
+
+    EXPECT_EQ(inner->parent, outer);
+    EXPECT_EQ(inner->depth, outer->depth + 1);
+    EXPECT_EQ(outer->total, 10);
+    EXPECT_EQ(outer->self, 5);
+    EXPECT_EQ(inner->total, 5);
+    EXPECT_EQ(inner->self, 5);
+}
+
+TEST_F(Profiler, PercentileFollowsHistogram) {
+    for (int i = 0; i < 99; i++) {
+        leaf_task(1);
+    }
+    leaf_task(100);
+
+    profiler_probe_t *leaf = profiler_find_probe("leaf");
+    ASSERT_NE(leaf, nullptr);
+    EXPECT_EQ(profiler_probe_percentile(leaf, 99), 1);
+    EXPECT_EQ(profiler_probe_percentile(leaf, 100), 100);
+
+    leaf_task(100);
+    EXPECT_EQ(profiler_probe_percentile(leaf, 99), 100);
+}
+
+TEST_F(Profiler, ResetClearsStatistics) {
+    leaf_task(4);
+    profiler_reset();
+
+    profiler_probe_t *leaf = profiler_find_probe("leaf");
+    ASSERT_NE(leaf, nullptr);
+    EXPECT_EQ(leaf->count, 0);
+    EXPECT_EQ(leaf->max, 0);
+    EXPECT_EQ(profiler_probe_percentile(leaf, 99), 0);
+
+    leaf_task(7);
+    EXPECT_EQ(leaf->count, 1);
+    EXPECT_EQ(leaf->min, 7);
+}
+
+static void recurse(uint8_t levels) {
+    PROFILER_BEGIN(recurse);
+    advance_time(1);
+    if (levels > 1) {
+        recurse(levels - 1);
+    }
+    PROFILER_END(recurse);
+}
+
+TEST_F(Profiler, ProbesBeyondMaxDepthAreSkipped) {
+    /* PROFILER_MAX_DEPTH is 3 for this test, the remaining levels must not disturb the nesting. */
+    recurse(5);
+
+    profiler_probe_t *probe = profiler_find_probe("recurse");
+    ASSERT_NE(probe, nullptr);
+    EXPECT_EQ(probe->count, 3);
+    EXPECT_EQ(probe->max, 5);
+
+    leaf_task(1);
+    EXPECT_EQ(profiler_find_probe("leaf")->parent, nullptr);
+}
+
+TEST_F(Profiler, UnbalancedEndIsIgnored) {
+    profiler_probe_t stray = PROFILER_PROBE_INIT("stray");
+    profiler_probe_end(&stray);
+
+    leaf_task(3);
+    EXPECT_EQ(profiler_find_probe("leaf")->max, 3);
+    EXPECT_EQ(profiler_find_probe("stray"), nullptr);
+}
+
+TEST_F(Profiler, DumpListsProbes) {
+    outer_task(1, 1, 1);
+    testing::internal::CaptureStdout();
+    profiler_dump();
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(output.find("outer: n=1"), std::string::npos);
+    EXPECT_NE(output.find("  inner: n=1"), std::string::npos);
+}
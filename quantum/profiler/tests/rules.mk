@@ -0,0 +1,7 @@
+profiler_DEFS := -DPROFILER_ENABLE -DPROFILER_MAX_DEPTH=3
+
+profiler_SRC := \
+    $(QUANTUM_PATH)/profiler/tests/profiler.cpp \
+    $(QUANTUM_PATH)/profiler.c \
+    $(PLATFORM_PATH)/timer.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
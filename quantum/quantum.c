@@ -15,6 +15,7 @@
  */
 
 #include "quantum.h"
+#include "profiler.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "process_backlight.h"
@@ -280,7 +281,7 @@ uint16_t get_event_keycode(keyevent_t event, bool update_layer_cache) {
 bool pre_process_record_quantum(keyrecord_t *record) {
     return pre_process_record_modules(get_record_keycode(record, true), record) && pre_process_record_kb(get_record_keycode(record, true), record) &&
 #ifdef COMBO_ENABLE
-           process_combo(get_record_keycode(record, true), record) &&
+           PROFILER_EVAL("process_combo", process_combo(get_record_keycode(record, true), record)) &&
 #endif
            true;
 }
@@ -313,7 +314,7 @@ bool process_record_quantum(keyrecord_t *record) {
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    if (preprocess_tap_dance(keycode, record)) {
+    if (PROFILER_EVAL("preprocess_tap_dance", preprocess_tap_dance(keycode, record))) {
         // The tap dance might have updated the layer state, therefore the
         // result of the keycode lookup might change.
         keycode = get_record_keycode(record, true);
@@ -386,10 +387,10 @@ bool process_record_quantum(keyrecord_t *record) {
             process_caps_word(keycode, record) &&
 #endif
 #ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
+            PROFILER_EVAL("process_key_override", process_key_override(keycode, record)) &&
 #endif
 #ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
+            PROFILER_EVAL("process_tap_dance", process_tap_dance(keycode, record)) &&
 #endif
 #if defined(UNICODE_COMMON_ENABLE)
             process_unicode_common(keycode, record) &&
@@ -425,7 +426,7 @@ bool process_record_quantum(keyrecord_t *record) {
             process_programmable_button(keycode, record) &&
 #endif
 #ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
+            PROFILER_EVAL("process_autocorrect", process_autocorrect(keycode, record)) &&
 #endif
 #ifdef TRI_LAYER_ENABLE
             process_tri_layer(keycode, record) &&
@@ -28,6 +28,20 @@
 
 #include <lib/lib8tion/lib8tion.h>
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    ifdef PROTOCOL_CHIBIOS
+#        include <ch.h>
+typedef systime_t rgb_render_time_t;
+#        define RGB_RENDER_TIME_READ() chVTGetSystemTimeX()
+#        define RGB_RENDER_TIME_ELAPSED_US(start) TIME_I2US(chVTTimeElapsedSinceX(start))
+#    else
+// No microsecond timer available, the budget is rounded up to whole milliseconds
+typedef uint32_t rgb_render_time_t;
+#        define RGB_RENDER_TIME_READ() timer_read32()
+#        define RGB_RENDER_TIME_ELAPSED_US(start) (timer_elapsed32(start) * 1000UL)
+#    endif
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
@@ -71,6 +85,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
 
 // internals
 static bool            suspend_state     = false;
@@ -78,6 +95,11 @@ static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static uint16_t rgb_frame_count        = 0;
+static uint16_t rgb_frame_rate         = 0;
+static uint32_t rgb_frame_rate_started = 0;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -141,6 +163,12 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
     return led_count;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+uint16_t rgb_matrix_get_frame_rate(void) {
+    return rgb_frame_rate;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 void rgb_matrix_update_pwm_buffers(void) {
     rgb_matrix_driver.flush();
 }
@@ -366,10 +394,42 @@ static void rgb_task_flush(uint8_t effect) {
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // frames completed over the last second
+    rgb_frame_count++;
+    uint32_t elapsed = sync_timer_elapsed32(rgb_frame_rate_started);
+    if (elapsed >= 1000) {
+        rgb_frame_rate         = (uint32_t)rgb_frame_count * 1000 / elapsed;
+        rgb_frame_count        = 0;
+        rgb_frame_rate_started = sync_timer_read32();
+    }
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
     // next task
     rgb_task_state = SYNCING;
 }
 
+static void rgb_task_render_step(uint8_t effect) {
+    rgb_task_render(effect);
+    if (effect) {
+        if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
+            rgb_matrix_indicators();
+        }
+        rgb_matrix_indicators_advanced(&rgb_effect_params);
+    }
+}
+
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static void rgb_task_render_budgeted(uint8_t effect) {
+    // render chunks of RGB_MATRIX_LED_PROCESS_LIMIT LEDs until the frame is done or the budget is used up,
+    // rgb_effect_params.iter carries the position over to the next task run
+    rgb_render_time_t start = RGB_RENDER_TIME_READ();
+    do {
+        rgb_task_render_step(effect);
+    } while (rgb_task_state == RENDERING && RGB_RENDER_TIME_ELAPSED_US(start) < RGB_MATRIX_RENDER_BUDGET_US);
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 void rgb_matrix_task(void) {
     rgb_task_timers();
 
@@ -388,13 +448,11 @@ void rgb_matrix_task(void) {
             rgb_task_start();
             break;
         case RENDERING:
-            rgb_task_render(effect);
-            if (effect) {
-                if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
-                    rgb_matrix_indicators();
-                }
-                rgb_matrix_indicators_advanced(&rgb_effect_params);
-            }
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            rgb_task_render_budgeted(effect);
+#else
+            rgb_task_render_step(effect);
+#endif // RGB_MATRIX_RENDER_BUDGET_US
             break;
         case FLUSHING:
             rgb_task_flush(effect);
@@ -473,9 +531,24 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+void rgb_matrix_update_led_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx              = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy              = g_led_config.point[i].y - k_rgb_matrix_center.y;
+        g_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+}
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+    rgb_matrix_update_led_geometry();
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
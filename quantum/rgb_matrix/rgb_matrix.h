@@ -87,7 +87,12 @@
 #endif
 
 #ifndef RGB_MATRIX_LED_PROCESS_LIMIT
-#    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
+#    ifdef RGB_MATRIX_RENDER_BUDGET_US
+// small chunks so that the time budget can be followed closely
+#        define RGB_MATRIX_LED_PROCESS_LIMIT 8
+#    else
+#        define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
+#    endif
 #endif
 
 struct rgb_matrix_limits_t {
@@ -171,6 +176,9 @@ bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+void rgb_matrix_update_led_geometry(void);
+#endif
 
 void rgb_matrix_reload_from_eeprom(void);
 
@@ -219,6 +227,9 @@ led_flags_t rgb_matrix_get_flags(void);
 void        rgb_matrix_set_flags(led_flags_t flags);
 void        rgb_matrix_set_flags_noeeprom(led_flags_t flags);
 void        rgb_matrix_update_pwm_buffers(void);
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+uint16_t    rgb_matrix_get_frame_rate(void);
+#endif
 
 #ifndef RGBLIGHT_ENABLE
 #    define eeconfig_update_rgblight_current eeconfig_force_flush_rgb_matrix
@@ -286,3 +297,6 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+extern led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif
@@ -69,6 +69,14 @@ typedef struct PACKED {
 
 #define NO_LED 255
 
+#ifdef RGB_MATRIX_LED_GEOMETRY_CACHE
+// Position of an LED relative to k_rgb_matrix_center
+typedef struct PACKED {
+    uint8_t dist;  // sqrt16(dx * dx + dy * dy)
+    uint8_t angle; // atan2_8(dy, dx)
+} led_geometry_t;
+#endif // RGB_MATRIX_LED_GEOMETRY_CACHE
+
 typedef struct PACKED {
     uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
     led_point_t point[RGB_MATRIX_LED_COUNT];
@@ -18,10 +18,12 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "quantum_keycodes.h"
 #include "keycode.h"
 #include "action.h"
+#include "timer.h"
 #include "wait.h"
 
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
@@ -150,73 +152,49 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
-void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
-    while (1) {
-        char ascii_code = getter(arg);
-        if (!ascii_code) break;
-        if (ascii_code == SS_QMK_PREFIX) {
-            ascii_code = getter(arg);
-
-            if (ascii_code == SS_TAP_CODE) {
-                // tap
-                uint8_t keycode = getter(arg);
-                tap_code(keycode);
-            } else if (ascii_code == SS_DOWN_CODE) {
-                // down
-                uint8_t keycode = getter(arg);
-                register_code(keycode);
-            } else if (ascii_code == SS_UP_CODE) {
-                // up
-                uint8_t keycode = getter(arg);
-                unregister_code(keycode);
-            } else if (ascii_code == SS_DELAY_CODE) {
-                // delay
-                int ms     = 0;
-                ascii_code = getter(arg);
-
-                while (isdigit(ascii_code)) {
-                    ms *= 10;
-                    ms += ascii_code - '0';
-                    ascii_code = getter(arg);
-                }
-
-                wait_ms(ms);
-            }
-
-            wait_ms(interval);
-
-            // if we had a delay that terminated with a null, we're done
-            if (ascii_code == 0) break;
-        } else {
-            send_char_with_delay(ascii_code, interval);
-        }
-    }
-}
-
-typedef struct send_string_memory_state_t {
-    const char *string;
-} send_string_memory_state_t;
-
-char send_string_get_next_ram(void *arg) {
-    send_string_memory_state_t *state = (send_string_memory_state_t *)arg;
-    char                        ret   = *state->string;
-    state->string++;
-    return ret;
-}
-
-void send_string_with_delay(const char *string, uint8_t interval) {
-    send_string_memory_state_t state = {string};
-    send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
+// Each character or command of a string is expanded into a short list of steps, each followed by a delay.
+// The blocking API executes them inline with wait_ms(), while the asynchronous API executes them from
+// send_string_task() once each delay has elapsed.
+#define SEND_STRING_MAX_STEPS 8
+
+typedef enum send_string_step_action_t {
+    SEND_STRING_STEP_REGISTER,
+    SEND_STRING_STEP_UNREGISTER,
+    SEND_STRING_STEP_WAIT,
+    SEND_STRING_STEP_BELL,
+} send_string_step_action_t;
+
+typedef struct send_string_step_t {
+    uint8_t  action;
+    uint8_t  keycode;
+    uint16_t delay;
+} send_string_step_t;
+
+typedef struct send_string_engine_t {
+    char (*getter)(void *);
+    void *arg;
+    union {
+        uint8_t  raw[SEND_STRING_GETTER_STATE_SIZE];
+        void *   align_ptr;
+        uint32_t align_u32;
+    } getter_state;
+    uint8_t            interval;
+    bool               getter_done;
+    uint8_t            step_count;
+    uint8_t            step_index;
+    send_string_step_t steps[SEND_STRING_MAX_STEPS];
+} send_string_engine_t;
+
+static inline void add_step(send_string_engine_t *engine, send_string_step_action_t action, uint8_t keycode, uint16_t delay) {
+    engine->steps[engine->step_count++] = (send_string_step_t){.action = action, .keycode = keycode, .delay = delay};
 }
 
-void send_char(char ascii_code) {
-    send_char_with_delay(ascii_code, TAP_CODE_DELAY);
-}
+static void expand_char(send_string_engine_t *engine, char ascii_code) {
+    uint8_t interval = engine->interval;
 
-void send_char_with_delay(char ascii_code, uint8_t interval) {
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
     if (ascii_code == '\a') { // BEL
-        PLAY_SONG(bell_song);
+        add_step(engine, SEND_STRING_STEP_BELL, 0, 0);
         return;
     }
 #endif
@@ -227,32 +205,259 @@ void send_char_with_delay(char ascii_code, uint8_t interval) {
     bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
 
     if (is_shifted) {
-        register_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        add_step(engine, SEND_STRING_STEP_REGISTER, KC_LEFT_SHIFT, interval);
     }
 
     if (is_altgred) {
-        register_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        add_step(engine, SEND_STRING_STEP_REGISTER, KC_RIGHT_ALT, interval);
     }
 
-    tap_code_delay(keycode, interval);
-    wait_ms(interval);
+    add_step(engine, SEND_STRING_STEP_REGISTER, keycode, interval);
+    add_step(engine, SEND_STRING_STEP_UNREGISTER, keycode, interval);
 
     if (is_altgred) {
-        unregister_code(KC_RIGHT_ALT);
-        wait_ms(interval);
+        add_step(engine, SEND_STRING_STEP_UNREGISTER, KC_RIGHT_ALT, interval);
     }
 
     if (is_shifted) {
-        unregister_code(KC_LEFT_SHIFT);
-        wait_ms(interval);
+        add_step(engine, SEND_STRING_STEP_UNREGISTER, KC_LEFT_SHIFT, interval);
     }
 
     if (is_dead) {
-        tap_code(KC_SPACE);
-        wait_ms(interval);
+        add_step(engine, SEND_STRING_STEP_REGISTER, KC_SPACE, TAP_CODE_DELAY);
+        add_step(engine, SEND_STRING_STEP_UNREGISTER, KC_SPACE, interval);
+    }
+}
+
+// Pulls the next character or command from the getter and expands it into steps, returns false at the end of the string.
+static bool expand_next(send_string_engine_t *engine) {
+    engine->step_count = 0;
+    engine->step_index = 0;
+
+    if (engine->getter_done) {
+        return false;
+    }
+
+    char ascii_code = engine->getter(engine->arg);
+    if (!ascii_code) {
+        engine->getter_done = true;
+        return false;
+    }
+
+    if (ascii_code != SS_QMK_PREFIX) {
+        expand_char(engine, ascii_code);
+        return true;
+    }
+
+    uint8_t interval = engine->interval;
+    ascii_code       = engine->getter(engine->arg);
+
+    if (ascii_code == SS_TAP_CODE) {
+        // tap
+        uint8_t keycode = engine->getter(engine->arg);
+        add_step(engine, SEND_STRING_STEP_REGISTER, keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+        add_step(engine, SEND_STRING_STEP_UNREGISTER, keycode, interval);
+    } else if (ascii_code == SS_DOWN_CODE) {
+        // down
+        uint8_t keycode = engine->getter(engine->arg);
+        add_step(engine, SEND_STRING_STEP_REGISTER, keycode, interval);
+    } else if (ascii_code == SS_UP_CODE) {
+        // up
+        uint8_t keycode = engine->getter(engine->arg);
+        add_step(engine, SEND_STRING_STEP_UNREGISTER, keycode, interval);
+    } else if (ascii_code == SS_DELAY_CODE) {
+        // delay
+        uint16_t ms = 0;
+        ascii_code  = engine->getter(engine->arg);
+
+        while (isdigit(ascii_code)) {
+            ms *= 10;
+            ms += ascii_code - '0';
+            ascii_code = engine->getter(engine->arg);
+        }
+
+        add_step(engine, SEND_STRING_STEP_WAIT, 0, ms + interval);
+    } else {
+        add_step(engine, SEND_STRING_STEP_WAIT, 0, interval);
+    }
+
+    // if we had a delay that terminated with a null, we're done
+    if (ascii_code == 0) {
+        engine->getter_done = true;
+    }
+
+    return true;
+}
+
+static void execute_step(const send_string_step_t *step) {
+    switch (step->action) {
+        case SEND_STRING_STEP_REGISTER:
+            register_code(step->keycode);
+            break;
+        case SEND_STRING_STEP_UNREGISTER:
+            unregister_code(step->keycode);
+            break;
+#if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+        case SEND_STRING_STEP_BELL:
+            PLAY_SONG(bell_song);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+static void run_steps_blocking(send_string_engine_t *engine) {
+    for (; engine->step_index < engine->step_count; engine->step_index++) {
+        const send_string_step_t *step = &engine->steps[engine->step_index];
+        execute_step(step);
+        wait_ms(step->delay);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous queue
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+static send_string_engine_t async_queue[SEND_STRING_ASYNC_QUEUE_SIZE];
+static uint8_t              async_queue_head  = 0;
+static uint8_t              async_queue_count = 0;
+static uint32_t             async_step_timer  = 0;
+static uint16_t             async_step_delay  = 0;
+
+bool send_string_async_is_busy(void) {
+    return async_queue_count > 0;
+}
+
+void send_string_async_flush(void) {
+    while (async_queue_count > 0) {
+        send_string_engine_t *engine = &async_queue[async_queue_head];
+
+        // Honour the remainder of any delay already in progress
+        uint32_t elapsed = timer_elapsed32(async_step_timer);
+        if (elapsed < async_step_delay) {
+            wait_ms(async_step_delay - elapsed);
+        }
+        async_step_delay = 0;
+
+        do {
+            run_steps_blocking(engine);
+        } while (expand_next(engine));
+
+        async_queue_head = (async_queue_head + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+        async_queue_count--;
+    }
+}
+
+void send_string_async_with_delay_impl(char (*getter)(void *), const void *arg, uint8_t arg_size, uint8_t interval) {
+    if (arg_size > SEND_STRING_GETTER_STATE_SIZE) {
+        // Can't take a copy of the getter state, so it has to be sent straight away
+        send_string_with_delay_impl(getter, (void *)arg, interval);
+        return;
+    }
+
+    if (async_queue_count >= SEND_STRING_ASYNC_QUEUE_SIZE) {
+        // No room, send everything queued so far to make some
+        send_string_async_flush();
+    }
+
+    send_string_engine_t *engine = &async_queue[(async_queue_head + async_queue_count) % SEND_STRING_ASYNC_QUEUE_SIZE];
+    *engine                      = (send_string_engine_t){
+        .getter   = getter,
+        .interval = interval,
+    };
+    memcpy(engine->getter_state.raw, arg, arg_size);
+    engine->arg = engine->getter_state.raw;
+
+    if (async_queue_count++ == 0) {
+        async_step_delay = 0;
+    }
+}
+
+void send_string_task(void) {
+    if (async_queue_count == 0 || timer_elapsed32(async_step_timer) < async_step_delay) {
+        return;
+    }
+
+    send_string_engine_t *engine = &async_queue[async_queue_head];
+    if (engine->step_index >= engine->step_count && !expand_next(engine)) {
+        // Finished with this string, the next one starts on the following task invocation
+        async_queue_head = (async_queue_head + 1) % SEND_STRING_ASYNC_QUEUE_SIZE;
+        async_queue_count--;
+        async_step_delay = 0;
+        return;
+    }
+
+    // Execute steps up until one that needs a delay, so that at most one character is sent per invocation
+    while (engine->step_index < engine->step_count) {
+        const send_string_step_t *step = &engine->steps[engine->step_index++];
+        execute_step(step);
+        if (step->delay > 0) {
+            async_step_timer = timer_read32();
+            async_step_delay = step->delay;
+            return;
+        }
     }
+    async_step_delay = 0;
+}
+#endif // SEND_STRING_ASYNC_ENABLE
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Blocking API
+
+void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+#ifdef SEND_STRING_ASYNC_ENABLE
+    // Anything already queued asynchronously needs to be sent first, to keep ordering
+    send_string_async_flush();
+#endif
+
+    send_string_engine_t engine = {
+        .getter   = getter,
+        .arg      = arg,
+        .interval = interval,
+    };
+    while (expand_next(&engine)) {
+        run_steps_blocking(&engine);
+    }
+}
+
+typedef struct send_string_memory_state_t {
+    const char *string;
+} send_string_memory_state_t;
+
+char send_string_get_next_ram(void *arg) {
+    send_string_memory_state_t *state = (send_string_memory_state_t *)arg;
+    char                        ret   = *state->string;
+    state->string++;
+    return ret;
+}
+
+void send_string_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_with_delay_impl(send_string_get_next_ram, &state, interval);
+}
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+void send_string_async(const char *string) {
+    send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+void send_string_async_with_delay(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_async_with_delay_impl(send_string_get_next_ram, &state, sizeof(state), interval);
+}
+#endif
+
+void send_char(char ascii_code) {
+    send_char_with_delay(ascii_code, TAP_CODE_DELAY);
+}
+
+void send_char_with_delay(char ascii_code, uint8_t interval) {
+    send_string_engine_t engine = {
+        .interval = interval,
+    };
+    expand_char(&engine, ascii_code);
+    run_steps_blocking(&engine);
 }
 
 void send_dword(uint32_t number) {
@@ -325,4 +530,11 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     send_string_memory_state_t state = {string};
     send_string_with_delay_impl(send_string_get_next_progmem, &state, interval);
 }
+
+#    ifdef SEND_STRING_ASYNC_ENABLE
+void send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    send_string_memory_state_t state = {string};
+    send_string_async_with_delay_impl(send_string_get_next_progmem, &state, sizeof(state), interval);
+}
+#    endif
 #endif
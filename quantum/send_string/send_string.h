@@ -24,10 +24,25 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
 
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    ifndef SEND_STRING_ASYNC_QUEUE_SIZE
+/**
+ * \brief The number of strings that can be waiting to be sent asynchronously at any one time.
+ */
+#        define SEND_STRING_ASYNC_QUEUE_SIZE 2
+#    endif
+#endif
+
+/**
+ * \brief The largest getter state, in bytes, that can be copied into the asynchronous queue.
+ */
+#define SEND_STRING_GETTER_STATE_SIZE 8
+
 // Look-Up Tables (LUTs) to convert ASCII character to keycode sequence.
 extern const uint8_t ascii_to_shift_lut[16];
 extern const uint8_t ascii_to_altgr_lut[16];
@@ -166,7 +181,73 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  *
  * The getter assumes that the next byte is available to be read, and returns it. `arg` is passed in and can be whatever
  * makes most sense for the getter -- each invocation of `getter` must advance its position in the source.
+ *
+ * Any strings queued with the asynchronous API are sent before this one, blocking until they are complete.
  */
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval);
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, without blocking.
+ *
+ * The string is read as it is sent, so it must remain valid until sending has finished.
+ *
+ * \param string The string to type out.
+ */
+void send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * The string is read as it is sent, so it must remain valid until sending has finished.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out from the main loop, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+void send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+
+/**
+ * \brief Asynchronous counterpart of send_string_with_delay_impl().
+ *
+ * `arg_size` bytes of `arg` are copied into the queue, and the getter is invoked with a pointer to that copy. If the
+ * state is larger than `SEND_STRING_GETTER_STATE_SIZE` the string is sent immediately instead. If the queue is full,
+ * the strings already queued are sent immediately to make room.
+ */
+void send_string_async_with_delay_impl(char (*getter)(void *), const void *arg, uint8_t arg_size, uint8_t interval);
+
+/**
+ * \brief Whether any strings are still waiting to be sent asynchronously.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Send all strings queued asynchronously, blocking until they are complete.
+ */
+void send_string_async_flush(void);
+
+/**
+ * \brief Advance asynchronous sending, invoked from the main loop.
+ */
+void send_string_task(void);
+#endif // defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+
 /** \} */
@@ -0,0 +1,55 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_matrix_delta.h"
+#include "crc.h"
+
+bool split_matrix_delta_encode(split_matrix_delta_t *frame, matrix_row_t published[], const matrix_row_t current[], uint8_t rows) {
+    uint8_t count = 0;
+
+    for (uint8_t row = 0; row < rows; row++) {
+        if (published[row] == current[row]) {
+            continue;
+        }
+        if (count < SPLIT_MATRIX_DELTA_ROWS) {
+            frame->rows[count]   = row;
+            frame->values[count] = current[row];
+            count++;
+        } else {
+            count = SPLIT_MATRIX_DELTA_KEYFRAME;
+            break;
+        }
+    }
+    if (count == 0) {
+        return false;
+    }
+
+    memcpy(published, current, rows * sizeof(matrix_row_t));
+    frame->count    = count;
+    frame->checksum = crc8(published, rows * sizeof(matrix_row_t));
+    frame->sequence++;
+    return true;
+}
+
+bool split_matrix_delta_apply(const split_matrix_delta_t *frame, matrix_row_t matrix[], uint8_t rows) {
+    if (frame->count > SPLIT_MATRIX_DELTA_ROWS || rows > MATRIX_ROWS) {
+        return false;
+    }
+
+    matrix_row_t result[MATRIX_ROWS];
+    memcpy(result, matrix, rows * sizeof(matrix_row_t));
+    for (uint8_t i = 0; i < frame->count; i++) {
+        if (frame->rows[i] >= rows) {
+            return false;
+        }
+        result[frame->rows[i]] = frame->values[i];
+    }
+    if (crc8(result, rows * sizeof(matrix_row_t)) != frame->checksum) {
+        return false;
+    }
+
+    memcpy(matrix, result, rows * sizeof(matrix_row_t));
+    return true;
+}
@@ -0,0 +1,55 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "matrix.h"
+
+/*
+    Delta frames for the slave matrix, enabled with `SPLIT_MATRIX_DELTA_ENABLE = yes` in rules.mk.
+
+    Each change of the slave's matrix produces a frame holding only the rows
+    that changed, numbered with a sequence that wraps at 256, and a checksum
+    of the whole matrix the frame results in. The master applies a frame only
+    on top of the one before it, anything else (a missed frame, too many rows
+    changed at once, a checksum mismatch) is resolved by reading the full
+    matrix, a keyframe.
+*/
+
+/** \brief Number of changed rows a single frame can carry, more than that within one scan needs a keyframe. */
+#ifndef SPLIT_MATRIX_DELTA_ROWS
+#    define SPLIT_MATRIX_DELTA_ROWS 1
+#endif
+
+/** \brief Interval at which the master reads the full matrix regardless of the frames. */
+#ifndef SPLIT_MATRIX_KEYFRAME_MS
+#    define SPLIT_MATRIX_KEYFRAME_MS 500
+#endif
+
+/** \brief Frame `count` of a change that did not fit, the master has to read the full matrix. */
+#define SPLIT_MATRIX_DELTA_KEYFRAME 0xFF
+
+typedef struct _split_matrix_delta_t {
+    matrix_row_t values[SPLIT_MATRIX_DELTA_ROWS];
+    uint8_t      rows[SPLIT_MATRIX_DELTA_ROWS];
+    uint8_t      count;    // number of rows carried, or SPLIT_MATRIX_DELTA_KEYFRAME
+    uint8_t      sequence; // incremented for every frame
+    uint8_t      checksum; // crc8 of the full matrix after applying the frame
+} split_matrix_delta_t;
+
+/**
+ * \brief Encodes the changes from `published` to `current` as the next frame, and updates `published` to match.
+ *
+ * \return false if nothing changed, `frame` is left untouched in that case.
+ */
+bool split_matrix_delta_encode(split_matrix_delta_t *frame, matrix_row_t published[], const matrix_row_t current[], uint8_t rows);
+
+/**
+ * \brief Applies `frame` on top of `matrix`.
+ *
+ * \return false if the frame is a keyframe marker, malformed, or does not result in its checksum. `matrix` is left
+ * untouched in that case.
+ */
+bool split_matrix_delta_apply(const split_matrix_delta_t *frame, matrix_row_t matrix[], uint8_t rows);
@@ -0,0 +1,8 @@
+# A 6x7 half, trace events in the right-hand columns land on it
+split_matrix_delta_codec_DEFS := -DMATRIX_ROWS=12 -DMATRIX_COLS=7
+split_matrix_delta_codec_INC := $(QUANTUM_PATH)/split_common
+
+split_matrix_delta_codec_SRC := \
+    $(QUANTUM_PATH)/split_common/tests/split_matrix_delta.cpp \
+    $(QUANTUM_PATH)/split_common/split_matrix_delta.c \
+    $(QUANTUM_PATH)/crc.c
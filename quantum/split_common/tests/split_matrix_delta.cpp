@@ -0,0 +1,240 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "split_matrix_delta.h"
+#include "crc.h"
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitMatrixDelta : public ::testing::Test {
+   protected:
+    split_matrix_delta_t frame                = {};
+    matrix_row_t         published[HALF_ROWS] = {0};
+    matrix_row_t         current[HALF_ROWS]   = {0};
+    matrix_row_t         received[HALF_ROWS]  = {0};
+
+    bool encode(void) {
+        return split_matrix_delta_encode(&frame, published, current, HALF_ROWS);
+    }
+
+    bool apply(void) {
+        return split_matrix_delta_apply(&frame, received, HALF_ROWS);
+    }
+};
+
+TEST_F(SplitMatrixDelta, NothingChanged) {
+    EXPECT_FALSE(encode());
+    EXPECT_EQ(frame.sequence, 0);
+    EXPECT_EQ(frame.count, 0);
+}
+
+TEST_F(SplitMatrixDelta, SingleRowRoundTrip) {
+    current[3] = 0b0100101;
+    ASSERT_TRUE(encode());
+
+    EXPECT_EQ(frame.sequence, 1);
+    EXPECT_EQ(frame.count, 1);
+    EXPECT_EQ(frame.rows[0], 3);
+    EXPECT_EQ(frame.values[0], 0b0100101);
+    EXPECT_EQ(memcmp(published, current, sizeof(current)), 0);
+
+    ASSERT_TRUE(apply());
+    EXPECT_EQ(memcmp(received, current, sizeof(current)), 0);
+}
+
+TEST_F(SplitMatrixDelta, TooManyRowsNeedKeyframe) {
+    for (int row = 0; row <= SPLIT_MATRIX_DELTA_ROWS; row++) {
+        current[row] = 1;
+    }
+    ASSERT_TRUE(encode());
+
+    EXPECT_EQ(frame.count, SPLIT_MATRIX_DELTA_KEYFRAME);
+    EXPECT_EQ(frame.checksum, crc8(current, sizeof(current)));
+    EXPECT_FALSE(apply());
+    EXPECT_EQ(received[0], 0);
+}
+
+TEST_F(SplitMatrixDelta, CorruptedFrameIsRejected) {
+    current[1] = 0b11;
+    ASSERT_TRUE(encode());
+
+    frame.values[0] ^= 0b100;
+    EXPECT_FALSE(apply());
+    EXPECT_EQ(received[1], 0);
+
+    frame.values[0] ^= 0b100;
+    frame.rows[0] = HALF_ROWS;
+    EXPECT_FALSE(apply());
+}
+
+TEST_F(SplitMatrixDelta, FrameOnWrongBaseIsRejected) {
+    current[0] = 1;
+    ASSERT_TRUE(encode());
+    current[1] = 1;
+    ASSERT_TRUE(encode());
+
+    // The first frame went missing, the second does not result in its checksum on top of an empty matrix
+    EXPECT_EQ(frame.sequence, 2);
+    EXPECT_FALSE(apply());
+    EXPECT_EQ(received[1], 0);
+}
+
+TEST_F(SplitMatrixDelta, SequenceWraps) {
+    frame.sequence = UINT8_MAX;
+    current[5]     = 1;
+    ASSERT_TRUE(encode());
+    EXPECT_EQ(frame.sequence, 0);
+}
+
+TEST_F(SplitMatrixDelta, RandomChangesStayInSync) {
+    std::mt19937 rng(1);
+    for (int i = 0; i < 10000; i++) {
+        current[rng() % HALF_ROWS] ^= MATRIX_ROW_SHIFTER << (rng() % MATRIX_COLS);
+        ASSERT_TRUE(encode());
+        ASSERT_TRUE(apply());
+        ASSERT_EQ(memcmp(received, current, sizeof(current)), 0);
+    }
+}
+
+struct link_cost_t {
+    uint64_t bytes;
+    uint64_t probe_bytes;
+};
+
+/*
+ * Wire bytes of the slave matrix transactions, counted the way split_transaction_get_stats() counts them: the full
+ * registered buffer of every transaction executed. The master polls once per scan, as the slave publishes.
+ */
+class LinkModel {
+   public:
+    virtual ~LinkModel() {}
+    virtual void scan(uint32_t now, const matrix_row_t slave[]) = 0;
+
+    matrix_row_t master[HALF_ROWS] = {0};
+    link_cost_t  cost              = {0, 0};
+};
+
+/* Checksum of the full matrix every scan, the matrix when it differs or every FORCED_SYNC_THROTTLE_MS. */
+class ChecksumLink : public LinkModel {
+   public:
+    void scan(uint32_t now, const matrix_row_t slave[]) override {
+        cost.bytes += sizeof(uint8_t);
+        cost.probe_bytes += sizeof(uint8_t);
+        if (now - last_update >= 100 || crc8(slave, sizeof(master)) != crc8(master, sizeof(master))) {
+            cost.bytes += sizeof(master);
+            memcpy(master, slave, sizeof(master));
+            last_update = now;
+        }
+    }
+
+    uint32_t last_update = 0;
+};
+
+/* Sequence every scan, a delta frame when it moved, the matrix and a frame for keyframes. */
+class DeltaLink : public LinkModel {
+   public:
+    void scan(uint32_t now, const matrix_row_t slave[]) override {
+        split_matrix_delta_encode(&frame, published, slave, HALF_ROWS);
+
+        cost.bytes += sizeof(frame.sequence);
+        cost.probe_bytes += sizeof(frame.sequence);
+        bool keyframe = now - last_keyframe >= SPLIT_MATRIX_KEYFRAME_MS;
+        if (!keyframe && frame.sequence != last_sequence) {
+            cost.bytes += sizeof(frame);
+            keyframe      = frame.sequence != (uint8_t)(last_sequence + 1) || !split_matrix_delta_apply(&frame, master, HALF_ROWS);
+            last_sequence = frame.sequence;
+        }
+        if (keyframe) {
+            cost.bytes += sizeof(published) + sizeof(frame);
+            memcpy(master, published, sizeof(master));
+            last_sequence = frame.sequence;
+            last_keyframe = now;
+        }
+    }
+
+    split_matrix_delta_t frame                = {};
+    matrix_row_t         published[HALF_ROWS] = {0};
+    uint8_t              last_sequence        = 0;
+    uint32_t             last_keyframe        = 0;
+};
+
+struct trace_event_t {
+    uint32_t time;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/* Same format as the key processing benchmark: "<time ms> <row> <col> <1 pressed | 0 released>", '#' for comments. */
+static std::vector<trace_event_t> load_trace(const std::string &path) {
+    std::vector<trace_event_t> events;
+    std::ifstream              file(path);
+    std::string                line;
+
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        unsigned           time, row, col, pressed;
+        if (!(fields >> time >> row >> col >> pressed)) {
+            ADD_FAILURE() << path << ": invalid event \"" << line << "\"";
+            return {};
+        }
+        events.push_back({time, (uint8_t)row, (uint8_t)col, pressed != 0});
+    }
+    return events;
+}
+
+/**
+ * Replays tests/benchmark/traces/typing.trace, or the trace given by SPLIT_MATRIX_DELTA_TRACE, on the slave half and
+ * prints the bytes per second of both schemes. The trace is for a 4x10 board, its right five columns are the slave.
+ */
+TEST(SplitMatrixDeltaTrace, BytesPerSecond) {
+    const char *path  = std::getenv("SPLIT_MATRIX_DELTA_TRACE");
+    std::string trace = path ? path : std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + "/../../../tests/benchmark/traces/typing.trace";
+
+    auto events = load_trace(trace);
+    ASSERT_FALSE(events.empty()) << "no events in " << trace;
+
+    ChecksumLink checksum;
+    DeltaLink    delta;
+    matrix_row_t slave[HALF_ROWS] = {0};
+    uint32_t     now              = 0;
+    size_t       next             = 0;
+
+    for (; next < events.size() || now <= events.back().time + 1000; now++) {
+        for (; next < events.size() && events[next].time == now; next++) {
+            const auto &event = events[next];
+            if (event.col >= 5 && event.row < HALF_ROWS) {
+                matrix_row_t bit = MATRIX_ROW_SHIFTER << (event.col - 5);
+                slave[event.row] = event.pressed ? (slave[event.row] | bit) : (slave[event.row] & ~bit);
+            }
+        }
+        checksum.scan(now, slave);
+        delta.scan(now, slave);
+        ASSERT_EQ(memcmp(delta.master, slave, sizeof(slave)), 0) << "master out of sync at " << now << " ms";
+    }
+
+    double seconds = now / 1000.0;
+    printf("trace:         %s\n", trace.c_str());
+    printf("scans:         %lu, %zu events\n", (unsigned long)now, events.size());
+    printf("%-14s %12s %12s\n", "scheme", "bytes/sec", "w/o probe");
+    printf("%-14s %12.1f %12.1f\n", "checksum", checksum.cost.bytes / seconds, (checksum.cost.bytes - checksum.cost.probe_bytes) / seconds);
+    printf("%-14s %12.1f %12.1f\n", "delta", delta.cost.bytes / seconds, (delta.cost.bytes - delta.cost.probe_bytes) / seconds);
+
+    EXPECT_LT(delta.cost.bytes, checksum.cost.bytes);
+}
@@ -23,7 +23,12 @@ enum serial_transaction_id {
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+    GET_SLAVE_MATRIX_SEQUENCE,
+    GET_SLAVE_MATRIX_DELTA,
+#else
     GET_SLAVE_MATRIX_CHECKSUM,
+#endif // SPLIT_MATRIX_DELTA_ENABLE
     GET_SLAVE_MATRIX_DATA,
 
 #ifdef SPLIT_TRANSPORT_MIRROR
@@ -99,6 +104,11 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#if defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+    PUT_BATCH_INFO,
+    PUT_BATCH_DATA,
+#endif // defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
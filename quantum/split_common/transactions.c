@@ -30,6 +30,8 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
+#include "profiler.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -84,9 +86,9 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#define transport_write(id, data, length) transaction_execute(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transaction_execute(id, NULL, 0, data, length)
+#define transport_exec(id) transaction_execute(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -97,6 +99,67 @@ void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *i
 ////////////////////////////////////////////////////
 // Helpers
 
+static split_transaction_stats_t transaction_stats = {0};
+
+static bool transaction_execute(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    transaction_stats.transactions++;
+    transaction_stats.bytes += trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+    return transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+static void transaction_stats_update(void) {
+    static uint32_t last_window         = 0;
+    static uint32_t window_transactions = 0;
+    static uint32_t window_bytes        = 0;
+    if (timer_elapsed32(last_window) >= 1000) {
+        transaction_stats.transactions_per_second = transaction_stats.transactions - window_transactions;
+        transaction_stats.bytes_per_second        = transaction_stats.bytes - window_bytes;
+        window_transactions                       = transaction_stats.transactions;
+        window_bytes                              = transaction_stats.bytes;
+        last_window                               = timer_read32();
+    }
+}
+
+split_transaction_stats_t split_transaction_get_stats(void) {
+    return transaction_stats;
+}
+
+// Transactions flagged through split_transaction_mark_dirty(), sent on the next scan regardless of their change detection
+static uint32_t transaction_sync_requested = 0;
+
+STATIC_ASSERT(NUM_TOTAL_TRANSACTIONS <= sizeof(transaction_sync_requested) * 8, "Transaction dirty mask too small");
+
+void split_transaction_mark_dirty(int8_t transaction_id) {
+    if (transaction_id >= 0 && transaction_id < NUM_TOTAL_TRANSACTIONS) {
+        transaction_sync_requested |= (1UL << transaction_id);
+    }
+}
+
+#ifdef SPLIT_TRANSACTION_BATCH_ENABLE
+
+STATIC_ASSERT(SPLIT_TRANSACTION_BATCH_SIZE <= UINT8_MAX, "SPLIT_TRANSACTION_BATCH_SIZE must fit the transaction buffer size");
+
+// Transactions whose data is staged in the master's shared memory, waiting for the next batch
+static uint32_t transaction_batch_pending = 0;
+
+static bool transaction_put(int8_t id, const void *data, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (trans->target2initiator_buffer_size > 0 || trans->initiator2target_buffer_size + 1 > SPLIT_TRANSACTION_BATCH_SIZE) {
+        return transport_write(id, data, length);
+    }
+    // Stage the data exactly where the transport would have put it, the batch is assembled from there
+    memcpy(split_trans_initiator2target_buffer(trans), data, MIN(trans->initiator2target_buffer_size, length));
+    transaction_batch_pending |= (1UL << id);
+    return true;
+}
+
+#else // SPLIT_TRANSACTION_BATCH_ENABLE
+
+#    define transaction_put(id, data, length) transport_write(id, data, length)
+
+#endif // SPLIT_TRANSACTION_BATCH_ENABLE
+
 static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[], const char *prefix, bool (*handler)(matrix_row_t master_matrix[], matrix_row_t slave_matrix[])) {
     int num_retries = is_transport_connected() ? 10 : 1;
     for (int iter = 1; iter <= num_retries; ++iter) {
@@ -113,9 +176,13 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     return false;
 }
 
-#define TRANSACTION_HANDLER_MASTER(prefix)                                                                              \
-    do {                                                                                                                \
-        if (!transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master)) return false; \
+// Each handler is profiled as split_<prefix>, the probe covers its retries
+#define TRANSACTION_HANDLER_MASTER(prefix)                                                                                \
+    do {                                                                                                                  \
+        PROFILER_BEGIN(split_##prefix);                                                                                   \
+        bool prefix##_okay = transaction_handler_master(master_matrix, slave_matrix, #prefix, &prefix##_handlers_master); \
+        PROFILER_END(split_##prefix);                                                                                     \
+        if (!prefix##_okay) return false;                                                                                 \
     } while (0)
 
 /**
@@ -161,10 +228,11 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
-    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+    if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition || (transaction_sync_requested & (1UL << trans_id))) {
+        okay &= transaction_put(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
+            transaction_sync_requested &= ~(1UL << trans_id);
         }
     }
     return okay;
@@ -178,6 +246,61 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t     last_keyframe                  = 0;
+    static bool         synced                         = false;
+    static uint8_t      last_sequence                  = 0;
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are errors
+
+    uint8_t sequence;
+    bool    okay     = transport_read(GET_SLAVE_MATRIX_SEQUENCE, &sequence, sizeof(sequence));
+    bool    keyframe = !synced || timer_elapsed32(last_keyframe) >= SPLIT_MATRIX_KEYFRAME_MS;
+    if (okay && !keyframe && sequence != last_sequence) {
+        split_matrix_delta_t frame;
+        okay = transport_read(GET_SLAVE_MATRIX_DELTA, &frame, sizeof(frame));
+        if (okay && frame.sequence == (uint8_t)(last_sequence + 1) && split_matrix_delta_apply(&frame, last_matrix, (MATRIX_ROWS) / 2)) {
+            last_sequence = frame.sequence;
+        } else {
+            // Missed a frame, too many rows changed at once, or the frame arrived corrupted
+            keyframe = true;
+        }
+    }
+    if (okay && keyframe) {
+        // The frame is read after the matrix, its checksum confirms both belong to the same state
+        matrix_row_t         temp_matrix[(MATRIX_ROWS) / 2];
+        split_matrix_delta_t frame;
+        okay = transport_read(GET_SLAVE_MATRIX_DATA, temp_matrix, sizeof(temp_matrix));
+        okay &= transport_read(GET_SLAVE_MATRIX_DELTA, &frame, sizeof(frame));
+        okay &= frame.checksum == crc8(temp_matrix, sizeof(temp_matrix));
+        if (okay) {
+            memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+            last_sequence = frame.sequence;
+            last_keyframe = timer_read32();
+            synced        = true;
+        }
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_matrix_delta_encode(&split_shmem->smatrix.delta, split_shmem->smatrix.matrix, slave_matrix, (MATRIX_ROWS) / 2);
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_SEQUENCE] = trans_target2initiator_initializer(smatrix.delta.sequence), \
+    [GET_SLAVE_MATRIX_DELTA]    = trans_target2initiator_initializer(smatrix.delta), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+// clang-format on
+
+#else // SPLIT_MATRIX_DELTA_ENABLE
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -199,13 +322,15 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -402,7 +527,7 @@ static void led_state_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 
 static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t   last_update    = 0;
-    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    bool              mods_need_sync = timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS || (transaction_sync_requested & (1UL << PUT_MODS));
     split_mods_sync_t new_mods;
     new_mods.real_mods = get_mods();
     if (!mods_need_sync && new_mods.real_mods != split_shmem->mods.real_mods) {
@@ -427,9 +552,10 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transaction_put(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
+            transaction_sync_requested &= ~(1UL << PUT_MODS);
         }
     }
 
@@ -914,6 +1040,106 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Batched transactions
+
+#if defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    while (transaction_batch_pending) {
+        // A lone change gains nothing from batching, send it through its own transaction
+        if ((transaction_batch_pending & (transaction_batch_pending - 1)) == 0) {
+            int8_t                    id    = __builtin_ctzl(transaction_batch_pending);
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            uint8_t                   data[SPLIT_TRANSACTION_BATCH_SIZE];
+            memcpy(data, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+            if (!transport_write(id, data, trans->initiator2target_buffer_size)) {
+                return false;
+            }
+            transaction_batch_pending = 0;
+            break;
+        }
+
+        // Pack as many pending transactions as fit as [id][data...] records
+        uint8_t  batch[SPLIT_TRANSACTION_BATCH_SIZE];
+        uint8_t  length = 0;
+        uint32_t packed = 0;
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+            if (!(transaction_batch_pending & (1UL << id))) {
+                continue;
+            }
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (length + 1 + trans->initiator2target_buffer_size > sizeof(batch)) {
+                continue; // goes into the next batch
+            }
+            batch[length++] = id;
+            memcpy(&batch[length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+            length += trans->initiator2target_buffer_size;
+            packed |= (1UL << id);
+        }
+
+        split_batch_info_t info = {.length = length};
+        info.checksum           = crc8(batch, length);
+
+        // Make sure the local side knows that we're not sending the full block of data
+        split_transaction_table[PUT_BATCH_DATA].initiator2target_buffer_size = length;
+
+        if (!transport_write(PUT_BATCH_INFO, &info, sizeof(info))) {
+            return false;
+        }
+        if (!transport_write(PUT_BATCH_DATA, batch, length)) {
+            return false;
+        }
+        transaction_batch_pending &= ~packed;
+    }
+    return true;
+}
+
+static void batch_info_handlers_slave(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t length = split_shmem->batch_info.length;
+    split_transaction_table[PUT_BATCH_DATA].initiator2target_buffer_size = length <= SPLIT_TRANSACTION_BATCH_SIZE ? length : SPLIT_TRANSACTION_BATCH_SIZE;
+}
+
+static void batch_data_handlers_slave(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const uint8_t *batch  = split_shmem->batch_data;
+    uint8_t        length = split_transaction_table[PUT_BATCH_DATA].initiator2target_buffer_size;
+    if (length != split_shmem->batch_info.length || crc8(batch, length) != split_shmem->batch_info.checksum) {
+        return;
+    }
+
+    // Unpack each record into the shared memory location its own transaction would have written
+    uint8_t offset = 0;
+    while (offset < length) {
+        int8_t id = batch[offset++];
+        if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS || id == PUT_BATCH_INFO || id == PUT_BATCH_DATA) {
+            return;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (trans->initiator2target_buffer_size == 0 || offset + trans->initiator2target_buffer_size > length) {
+            return;
+        }
+        memcpy(split_trans_initiator2target_buffer(trans), &batch[offset], trans->initiator2target_buffer_size);
+        offset += trans->initiator2target_buffer_size;
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), 0, NULL);
+        }
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [PUT_BATCH_INFO] = trans_initiator2target_initializer_cb(batch_info, batch_info_handlers_slave), \
+    [PUT_BATCH_DATA] = trans_initiator2target_initializer_cb(batch_data, batch_data_handlers_slave),
+// clang-format on
+
+#else // defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1170,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -955,6 +1182,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    transaction_stats_update();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -974,6 +1202,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
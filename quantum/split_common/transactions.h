@@ -41,10 +41,23 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+typedef struct _split_transaction_stats_t {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t transactions_per_second;
+    uint32_t bytes_per_second;
+} split_transaction_stats_t;
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+// Forces the given transaction to be sent on the next scan, even if the master side sees no change
+void split_transaction_mark_dirty(int8_t transaction_id);
+
+// Totals since boot, plus the rates measured over the last full second
+split_transaction_stats_t split_transaction_get_stats(void);
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
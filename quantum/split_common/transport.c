@@ -22,6 +22,7 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "profiler.h"
 
 #ifdef USE_I2C
 
@@ -123,7 +124,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    return transactions_master(master_matrix, slave_matrix);
+    PROFILER_BEGIN(transactions_master);
+    const bool okay = transactions_master(master_matrix, slave_matrix);
+    PROFILER_END(transactions_master);
+    return okay;
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -23,6 +23,10 @@
 #include "action_layer.h"
 #include "matrix.h"
 
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+#    include "split_matrix_delta.h"
+#endif // SPLIT_MATRIX_DELTA_ENABLE
+
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
 #endif // RPC_M2S_BUFFER_SIZE
@@ -31,6 +35,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSACTION_BATCH_SIZE
+#    define SPLIT_TRANSACTION_BATCH_SIZE 48
+#endif // SPLIT_TRANSACTION_BATCH_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -53,7 +61,11 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #endif // RGBLIGHT_ENABLE
 
 typedef struct _split_slave_matrix_sync_t {
-    uint8_t      checksum;
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+    split_matrix_delta_t delta;
+#else
+    uint8_t checksum;
+#endif // SPLIT_MATRIX_DELTA_ENABLE
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
@@ -147,6 +159,13 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#if defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+typedef struct _split_batch_info_t {
+    uint8_t checksum;
+    uint8_t length;
+} split_batch_info_t;
+#endif // defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
@@ -222,6 +241,11 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#if defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+    split_batch_info_t batch_info;
+    uint8_t            batch_data[SPLIT_TRANSACTION_BATCH_SIZE];
+#endif // defined(SPLIT_TRANSACTION_BATCH_ENABLE)
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
@@ -32,6 +32,20 @@ wear_leveling_2byte_optimized_writes_SRC := \
 wear_leveling_2byte_optimized_writes_INC := \
 	$(wear_leveling_common_INC)
 
+wear_leveling_2byte_incremental_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=1024 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=128 \
+	-DWEAR_LEVELING_INCREMENTAL_PLAYBACK \
+	-DWEAR_LEVELING_PLAYBACK_CHUNK_SIZE=4 \
+	-DWEAR_LEVELING_CONSOLIDATE_THRESHOLD=50
+wear_leveling_2byte_incremental_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_2byte_incremental.cpp
+wear_leveling_2byte_incremental_INC := \
+	$(wear_leveling_common_INC)
+
 wear_leveling_2byte_DEFS := \
 	$(wear_leveling_common_DEFS) \
 	-DBACKING_STORE_WRITE_SIZE=2 \
@@ -2,5 +2,6 @@ TEST_LIST += \
 	wear_leveling_general \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
+	wear_leveling_2byte_incremental \
 	wear_leveling_4byte \
 	wear_leveling_8byte
@@ -0,0 +1,265 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+static wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+    memcpy(&verify_data[address], value, length);
+    return wear_leveling_write(address, value, length);
+}
+
+/**
+ * Runs wear_leveling_task() until it stops touching the backing store, returning the status of the last invocation that did.
+ */
+static wear_leveling_status_t drain_playback(std::size_t* invocations = nullptr, std::uint64_t* max_reads = nullptr) {
+    auto&                  inst   = MockBackingStore::Instance();
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    std::size_t            count  = 0;
+    std::uint64_t          most   = 0;
+    while (true) {
+        std::uint64_t          reads       = inst.read_invoke_count();
+        wear_leveling_status_t this_status = wear_leveling_task();
+        reads                              = inst.read_invoke_count() - reads;
+        if (reads == 0) {
+            break;
+        }
+        status = this_status;
+        most   = std::max(most, reads);
+        ++count;
+    }
+    if (invocations) *invocations = count;
+    if (max_reads) *max_reads = most;
+    return status;
+}
+
+/**
+ * Fills the write log with a mix of single byte, 0/1 word and multi-byte entries, overwriting earlier values as it wraps.
+ */
+static void populate_log(int count) {
+    for (int i = 0; i < count; ++i) {
+        switch (i % 3) {
+            case 0: {
+                uint8_t v = (uint8_t)(i + 1);
+                test_write(i % 64, &v, sizeof(v));
+            } break;
+            case 1: {
+                uint16_t v = (uint16_t)(i & 1);
+                test_write((i * 2) % 64, &v, sizeof(v));
+            } break;
+            case 2: {
+                uint8_t v[5] = {(uint8_t)i, (uint8_t)(i + 1), (uint8_t)(i + 2), (uint8_t)(i + 3), (uint8_t)(i + 4)};
+                test_write(64 + (i % 59), v, sizeof(v));
+            } break;
+        }
+    }
+}
+
+static void expect_contents(void) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+    EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_THAT(actual, testing::ElementsAreArray(verify_data)) << "Invalid readback";
+}
+
+class WearLevelingIncremental : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        drain_playback();
+        verify_data.fill(0);
+    }
+};
+
+/**
+ * This test verifies that initialization reads the consolidated area and its checksum only, regardless of the size of the write log.
+ */
+TEST_F(WearLevelingIncremental, InitDoesNotPlayBackLog) {
+    auto& inst = MockBackingStore::Instance();
+    populate_log(60);
+
+    std::uint64_t reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(inst.read_invoke_count() - reads, (WEAR_LEVELING_LOGICAL_SIZE / BACKING_STORE_WRITE_SIZE) + 4) << "Init should only read the consolidated data and checksum";
+
+    reads = inst.read_invoke_count();
+    drain_playback();
+    EXPECT_GE(inst.read_invoke_count() - reads, 60) << "Playback should have read every log entry";
+    expect_contents();
+}
+
+/**
+ * This test verifies that each task invocation plays back a bounded number of log entries.
+ */
+TEST_F(WearLevelingIncremental, PlaybackIsChunked) {
+    populate_log(60);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+    std::size_t   invocations;
+    std::uint64_t max_reads;
+    EXPECT_EQ(drain_playback(&invocations, &max_reads), WEAR_LEVELING_SUCCESS) << "Playback returned incorrect status";
+
+    // A multi-byte entry takes up to 4 slots, plus the read of the empty slot ending the log
+    EXPECT_LE(max_reads, (WEAR_LEVELING_PLAYBACK_CHUNK_SIZE * 4) + 1) << "Too many reads in a single invocation";
+    EXPECT_GE(invocations, 60 / 3 / WEAR_LEVELING_PLAYBACK_CHUNK_SIZE) << "Playback should be spread over several invocations";
+    expect_contents();
+}
+
+/**
+ * This test verifies that reads made while playback is in progress return the latest values.
+ */
+TEST_F(WearLevelingIncremental, ReadsDuringPlaybackSeeLatestValues) {
+    auto& inst = MockBackingStore::Instance();
+    populate_log(90);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+
+    expect_contents();
+    while (true) {
+        std::uint64_t reads = inst.read_invoke_count();
+        wear_leveling_task();
+        if (inst.read_invoke_count() == reads) {
+            break;
+        }
+        expect_contents();
+    }
+    expect_contents();
+}
+
+/**
+ * This test verifies that the reads quantum_init() makes before the first matrix scan see the latest values without finishing playback.
+ */
+TEST_F(WearLevelingIncremental, StartupReadsLeavePlaybackPending) {
+    auto& inst = MockBackingStore::Instance();
+
+    // A few eeconfig-like values at the start of the log, followed by a long run of dynamic keymap-like writes
+    uint16_t magic         = 0xFEE8;
+    uint8_t  debug         = 0x81;
+    uint8_t  default_layer = 0x02;
+    uint16_t keymap        = 0x1234;
+    test_write(0, &magic, sizeof(magic));
+    test_write(2, &debug, sizeof(debug));
+    test_write(3, &default_layer, sizeof(default_layer));
+    test_write(4, &keymap, sizeof(keymap));
+    for (int i = 0; i < 40; ++i) {
+        uint8_t v[4] = {(uint8_t)i, (uint8_t)(i + 1), (uint8_t)(i + 2), (uint8_t)(i + 3)};
+        test_write(64 + ((i * 4) % 60), v, sizeof(v));
+    }
+
+    // Backing store reads a non-incremental init takes for the same log: the consolidated data plus a complete playback
+    std::uint64_t reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    drain_playback();
+    std::uint64_t full_init_reads = inst.read_invoke_count() - reads;
+
+    // Init followed by the reads quantum_init() makes before the first matrix scan: eeconfig_is_enabled(), eeconfig_read_debug(), eeconfig_read_keymap() and eeconfig_read_default_layer()
+    reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    uint16_t read16;
+    uint8_t  read8;
+    EXPECT_EQ(wear_leveling_read(0, &read16, sizeof(read16)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(read16, magic) << "Invalid readback of magic";
+    EXPECT_EQ(wear_leveling_read(2, &read8, sizeof(read8)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(read8, debug) << "Invalid readback of debug";
+    EXPECT_EQ(wear_leveling_read(4, &read16, sizeof(read16)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(read16, keymap) << "Invalid readback of keymap";
+    EXPECT_EQ(wear_leveling_read(3, &read8, sizeof(read8)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(read8, default_layer) << "Invalid readback of default layer";
+    std::uint64_t startup_reads = inst.read_invoke_count() - reads;
+    EXPECT_LT(startup_reads, full_init_reads) << "Startup should take fewer backing store reads than a complete playback";
+
+    // Once indexed, each read only decodes the six eeconfig entries
+    reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_read(2, &read8, sizeof(read8)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_LE(inst.read_invoke_count() - reads, 6) << "Reads should only decode the entries touching them";
+
+    // Nothing in the log touches the end of the first 64 bytes
+    reads = inst.read_invoke_count();
+    EXPECT_EQ(wear_leveling_read(56, &read8, sizeof(read8)), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(read8, 0) << "Invalid readback of untouched data";
+    EXPECT_EQ(inst.read_invoke_count(), reads) << "Untouched data should be served from the cache alone";
+
+    // The main loop runs the first matrix scan before wear_leveling_task(), which still has the whole log to play back
+    std::size_t invocations;
+    drain_playback(&invocations);
+    EXPECT_GE(invocations, 40 / WEAR_LEVELING_PLAYBACK_CHUNK_SIZE) << "Startup reads should have left playback to the main loop";
+    expect_contents();
+}
+
+/**
+ * This test verifies that a write during playback completes the playback first, and appends after the existing log entries.
+ */
+TEST_F(WearLevelingIncremental, WriteDuringPlaybackAppendsToLog) {
+    populate_log(60);
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    wear_leveling_task();
+
+    uint8_t single = 0x5A;
+    uint8_t multi[4] = {0xA1, 0xA2, 0xA3, 0xA4};
+    EXPECT_EQ(test_write(0x03, &single, sizeof(single)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(test_write(0x50, multi, sizeof(multi)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    expect_contents();
+
+    // Nothing is left to play back
+    std::size_t invocations;
+    drain_playback(&invocations);
+    EXPECT_EQ(invocations, 0) << "Playback should have been completed by the write";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    expect_contents();
+    drain_playback();
+    expect_contents();
+}
+
+/**
+ * This test verifies that a corrupt log entry stops playback at the same point for reads and the background playback.
+ */
+TEST_F(WearLevelingIncremental, CorruptEntryStopsPlayback) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  logstart = inst.storage_begin() + ((WEAR_LEVELING_LOGICAL_SIZE + 8) / sizeof(backing_store_int_t));
+
+    uint8_t v = 0x11;
+    test_write(0x01, &v, sizeof(v));
+    v = 0x22;
+    test_write(0x02, &v, sizeof(v));
+
+    // Entry type 3 does not exist, the valid entry after it must be ignored
+    (logstart + 2)->set(~(backing_store_int_t)0x00C0);
+    (logstart + 3)->set(~LOG_ENTRY_MAKE_OPTIMIZED_64(0x03, 0x33).raw16[0]);
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    expect_contents();
+    EXPECT_EQ(drain_playback(), WEAR_LEVELING_CONSOLIDATED) << "Playback should have consolidated after the corrupt entry";
+    expect_contents();
+}
+
+/**
+ * This test verifies that the task consolidates once the write log passes the configured threshold, and not before.
+ */
+TEST_F(WearLevelingIncremental, BackgroundConsolidationAtThreshold) {
+    auto&          inst      = MockBackingStore::Instance();
+    constexpr auto log_slots = (WEAR_LEVELING_BACKING_SIZE - (WEAR_LEVELING_LOGICAL_SIZE + 8)) / BACKING_STORE_WRITE_SIZE;
+    constexpr auto threshold = (log_slots * WEAR_LEVELING_CONSOLIDATE_THRESHOLD + 99) / 100;
+
+    // Single byte writes below 64 take a single slot each
+    for (std::size_t i = 0; i < threshold - 1; ++i) {
+        uint8_t v = (uint8_t)(i + 1);
+        EXPECT_EQ(test_write(i % 64, &v, sizeof(v)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+    std::uint64_t erasures = inst.erasure_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should not consolidate below the threshold";
+    EXPECT_EQ(inst.erasure_count(), erasures) << "Task should not consolidate below the threshold";
+
+    uint8_t v = 0xEE;
+    EXPECT_EQ(test_write(0x3F, &v, sizeof(v)), WEAR_LEVELING_SUCCESS) << "Write should not consolidate before the log is full";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_CONSOLIDATED) << "Task should consolidate at the threshold";
+    EXPECT_EQ(inst.erasure_count(), erasures + 1) << "Task should consolidate at the threshold";
+    EXPECT_TRUE(inst.is_locked()) << "Backing store should be locked again";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Consolidation should have emptied the log";
+
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    drain_playback();
+    expect_contents();
+}
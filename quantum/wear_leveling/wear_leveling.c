@@ -62,15 +62,39 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_INCREMENTAL_PLAYBACK: When defined, initialization only
+            loads the consolidated data and the write log is played back in
+            chunks from wear_leveling_task(). Reads before playback completes
+            are resolved through the read-through index, any write finishes
+            playback first.
+
+        - WEAR_LEVELING_INDEX_BLOCKS: The number of blocks logical data is split
+            into for the read-through index. More blocks means reads during
+            playback decode fewer unrelated log entries, at 8 bytes of RAM each.
+
+        - WEAR_LEVELING_PLAYBACK_CHUNK_SIZE: The number of write log entries
+            played back per wear_leveling_task() invocation.
+
+        - WEAR_LEVELING_CONSOLIDATE_THRESHOLD: Percentage of the write log in
+            use at which wear_leveling_task() consolidates in the background,
+            rather than waiting for a write to fill the log.
+
     General algorithm:
 
         During initialization:
             * The contents of the consolidated data section are read into cache.
             * The contents of the write log are "played back" and update the
-                cache accordingly.
+                cache accordingly. With incremental playback this is deferred
+                to wear_leveling_task(), any write finishes it immediately.
 
         During reads:
             * Logical data is served from the cache.
+            * While incremental playback is pending, the log entries not yet
+                played back which touch the read are applied on top. The first
+                such read indexes which blocks of logical data each remaining
+                entry touches, reading entry headers only; reads then decode
+                just the span of the log between the first and last entries
+                touching their blocks.
 
         During writes:
             * The cache is updated with the new data.
@@ -163,6 +187,15 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    bool     playback_pending; // write_address is the playback position until this is cleared
+    bool     index_complete; // index covers every log entry not yet played back
+    uint32_t index_address;  // log entries between the playback position and here are indexed
+    struct {
+        uint32_t first; // backing store address of the first log entry touching the block
+        uint32_t last;  // backing store address of the last log entry touching the block, zero if there are none
+    } index[(WEAR_LEVELING_INDEX_BLOCKS)];
+#endif
 } wear_leveling;
 
 /**
@@ -471,135 +504,159 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
 }
 
 /**
- * "Replays" the write log from the backing store, updating the local cache with updated values.
+ * A single logical write, as decoded from the write log.
  */
-static wear_leveling_status_t wear_leveling_playback_log(void) {
-    wl_dprintf("Playback write log\n");
+typedef struct wear_leveling_log_write_t {
+    uint32_t address;
+    uint8_t  length;
+    uint8_t  data[LOG_ENTRY_MULTIBYTE_MAX_BYTES];
+} wear_leveling_log_write_t;
 
-    wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
-    bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
-        backing_store_int_t value;
-        bool                ok = backing_store_read(address, &value);
-        if (!ok) {
-            wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-            cancel_playback = true;
-            status          = WEAR_LEVELING_FAILED;
-            break;
-        }
-        if (value == 0) {
-            wl_dprintf("Found empty slot, no more log entries\n");
-            cancel_playback = true;
-            break;
-        }
+/**
+ * Decodes the write log entry at the supplied backing store address, advancing the address past the entry.
+ * Sets `end_of_log` instead if the slot is empty or the end of the backing store has been reached.
+ * With `headers_only` set, the data of multi-byte entries is skipped rather than read, only the address and length are decoded.
+ */
+static wear_leveling_status_t wear_leveling_decode_log_entry(uint32_t *address, wear_leveling_log_write_t *write, bool headers_only, bool *end_of_log) {
+    *end_of_log = false;
+    if (*address >= (WEAR_LEVELING_BACKING_SIZE)) {
+        *end_of_log = true;
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    backing_store_int_t value;
+    bool                ok = backing_store_read(*address, &value);
+    if (!ok) {
+        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+        return WEAR_LEVELING_FAILED;
+    }
+    if (value == 0) {
+        wl_dprintf("Found empty slot, no more log entries\n");
+        *end_of_log = true;
+        return WEAR_LEVELING_SUCCESS;
+    }
 
-        // If we got a nonzero value, then we need to increment the address to ensure next write occurs at next location
-        address += (BACKING_STORE_WRITE_SIZE);
+    // If we got a nonzero value, then we need to increment the address to ensure next write occurs at next location
+    *address += (BACKING_STORE_WRITE_SIZE);
 
-        // Read from the write log
-        write_log_entry_t log;
+    // Read from the write log
+    write_log_entry_t log;
 #if BACKING_STORE_WRITE_SIZE == 2
-        log.raw16[0] = value;
+    log.raw16[0] = value;
 #elif BACKING_STORE_WRITE_SIZE == 4
-        log.raw32[0] = value;
+    log.raw32[0] = value;
 #elif BACKING_STORE_WRITE_SIZE == 8
-        log.raw64 = value;
+    log.raw64 = value;
 #endif
 
-        switch (LOG_ENTRY_GET_TYPE(log)) {
-            case LOG_ENTRY_TYPE_MULTIBYTE: {
+    switch (LOG_ENTRY_GET_TYPE(log)) {
+        case LOG_ENTRY_TYPE_MULTIBYTE: {
 #if BACKING_STORE_WRITE_SIZE == 2
-                ok = backing_store_read(address, &log.raw16[1]);
-                if (!ok) {
-                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
-                    break;
-                }
-                address += (BACKING_STORE_WRITE_SIZE);
+            ok = backing_store_read(*address, &log.raw16[1]);
+            if (!ok) {
+                wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                return WEAR_LEVELING_FAILED;
+            }
+            *address += (BACKING_STORE_WRITE_SIZE);
 #endif // BACKING_STORE_WRITE_SIZE == 2
-                const uint32_t a = LOG_ENTRY_MULTIBYTE_GET_ADDRESS(log);
-                const uint8_t  l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
+            const uint32_t a = LOG_ENTRY_MULTIBYTE_GET_ADDRESS(log);
+            const uint8_t  l = LOG_ENTRY_MULTIBYTE_GET_LENGTH(log);
 
-                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
-                    break;
-                }
+            if (a + l > (WEAR_LEVELING_LOGICAL_SIZE) || l > LOG_ENTRY_MULTIBYTE_MAX_BYTES) {
+                return WEAR_LEVELING_FAILED;
+            }
 
 #if BACKING_STORE_WRITE_SIZE == 2
-                if (l > 1) {
-                    ok = backing_store_read(address, &log.raw16[2]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status          = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
+            if (l > 1) {
+                ok = headers_only || backing_store_read(*address, &log.raw16[2]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    return WEAR_LEVELING_FAILED;
                 }
-                if (l > 3) {
-                    ok = backing_store_read(address, &log.raw16[3]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status          = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
+                *address += (BACKING_STORE_WRITE_SIZE);
+            }
+            if (l > 3) {
+                ok = headers_only || backing_store_read(*address, &log.raw16[3]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    return WEAR_LEVELING_FAILED;
                 }
+                *address += (BACKING_STORE_WRITE_SIZE);
+            }
 #elif BACKING_STORE_WRITE_SIZE == 4
-                if (l > 1) {
-                    ok = backing_store_read(address, &log.raw32[1]);
-                    if (!ok) {
-                        wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
-                        cancel_playback = true;
-                        status = WEAR_LEVELING_FAILED;
-                        break;
-                    }
-                    address += (BACKING_STORE_WRITE_SIZE);
+            if (l > 1) {
+                ok = headers_only || backing_store_read(*address, &log.raw32[1]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    return WEAR_LEVELING_FAILED;
                 }
+                *address += (BACKING_STORE_WRITE_SIZE);
+            }
 #endif
 
-                memcpy(&wear_leveling.cache[a], &log.raw8[3], l);
-            } break;
+            write->address = a;
+            write->length  = l;
+            memcpy(write->data, &log.raw8[3], l);
+        } break;
 #if BACKING_STORE_WRITE_SIZE == 2
-            case LOG_ENTRY_TYPE_OPTIMIZED_64: {
-                const uint32_t a = LOG_ENTRY_OPTIMIZED_64_GET_ADDRESS(log);
-                const uint8_t  v = LOG_ENTRY_OPTIMIZED_64_GET_VALUE(log);
-
-                if (a >= (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
-                    break;
-                }
+        case LOG_ENTRY_TYPE_OPTIMIZED_64: {
+            const uint32_t a = LOG_ENTRY_OPTIMIZED_64_GET_ADDRESS(log);
+            const uint8_t  v = LOG_ENTRY_OPTIMIZED_64_GET_VALUE(log);
+
+            if (a >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                return WEAR_LEVELING_FAILED;
+            }
 
-                wear_leveling.cache[a] = v;
-            } break;
-            case LOG_ENTRY_TYPE_WORD_01: {
-                const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
-                const uint8_t  v = LOG_ENTRY_WORD_01_GET_VALUE(log);
+            write->address = a;
+            write->length  = 1;
+            write->data[0] = v;
+        } break;
+        case LOG_ENTRY_TYPE_WORD_01: {
+            const uint32_t a = LOG_ENTRY_WORD_01_GET_ADDRESS(log);
+            const uint8_t  v = LOG_ENTRY_WORD_01_GET_VALUE(log);
 
-                if (a + 1 >= (WEAR_LEVELING_LOGICAL_SIZE)) {
-                    cancel_playback = true;
-                    status          = WEAR_LEVELING_FAILED;
-                    break;
-                }
+            if (a + 1 >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                return WEAR_LEVELING_FAILED;
+            }
 
-                wear_leveling.cache[a + 0] = v;
-                wear_leveling.cache[a + 1] = 0;
-            } break;
+            write->address = a;
+            write->length  = 2;
+            write->data[0] = v;
+            write->data[1] = 0;
+        } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
-            default: {
-                cancel_playback = true;
-                status          = WEAR_LEVELING_FAILED;
-            } break;
+        default: {
+            return WEAR_LEVELING_FAILED;
+        } break;
+    }
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
+/**
+ * "Replays" up to `max_entries` entries of the write log from the backing store, updating the local cache with updated values.
+ * Playback resumes from, and advances, the current write address; once the end of the log is found it is the new write location.
+ *
+ * @return WEAR_LEVELING_SUCCESS with `complete` unset if there are entries left to play back, otherwise the final status of the playback
+ */
+static wear_leveling_status_t wear_leveling_playback_log_entries(uint32_t max_entries, bool *complete) {
+    wear_leveling_status_t status     = WEAR_LEVELING_SUCCESS;
+    bool                   end_of_log = false;
+    for (uint32_t i = 0; i < max_entries && !end_of_log; ++i) {
+        wear_leveling_log_write_t write;
+        status = wear_leveling_decode_log_entry(&wear_leveling.write_address, &write, false, &end_of_log);
+        if (status == WEAR_LEVELING_FAILED) {
+            break;
+        }
+        if (!end_of_log) {
+            memcpy(&wear_leveling.cache[write.address], write.data, write.length);
         }
     }
 
-    // We've reached the end of the log, so we're at the new write location
-    wear_leveling.write_address = address;
+    *complete = end_of_log || status == WEAR_LEVELING_FAILED;
+    if (!*complete) {
+        return WEAR_LEVELING_SUCCESS;
+    }
 
     if (status == WEAR_LEVELING_FAILED) {
         // If we had a failure during readback, assume we're corrupted -- force a consolidation with the data we already have
@@ -612,6 +669,121 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
     return status;
 }
 
+#ifndef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+/**
+ * "Replays" the whole write log from the backing store, updating the local cache with updated values.
+ */
+static wear_leveling_status_t wear_leveling_playback_log(void) {
+    wl_dprintf("Playback write log\n");
+
+    // Start at the beginning of the log, +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8;
+
+    bool complete;
+    return wear_leveling_playback_log_entries(UINT32_MAX, &complete);
+}
+#else
+/**
+ * Starts a deferred playback of the write log, with an empty read-through index.
+ */
+static void wear_leveling_playback_begin(void) {
+    wear_leveling.playback_pending = true;
+    wear_leveling.index_complete   = false;
+    wear_leveling.index_address    = wear_leveling.write_address;
+    memset(wear_leveling.index, 0, sizeof(wear_leveling.index));
+}
+
+/**
+ * Extends the index over the rest of the write log, recording the span of entries touching each block of logical data.
+ * Only entry headers are read, and indexing resumes where it stopped -- each entry is indexed at most once, and not at all if playback reached it first.
+ */
+static void wear_leveling_index_extend(void) {
+    if (wear_leveling.index_complete) {
+        return;
+    }
+
+    wl_dprintf("Indexing write log\n");
+    uint32_t log_address = wear_leveling.index_address > wear_leveling.write_address ? wear_leveling.index_address : wear_leveling.write_address;
+    bool     end_of_log  = false;
+    while (!end_of_log) {
+        uint32_t                  entry_address = log_address;
+        wear_leveling_log_write_t write;
+        if (wear_leveling_decode_log_entry(&log_address, &write, true, &end_of_log) == WEAR_LEVELING_FAILED) {
+            // Playback stops at the same entry, so anything after it never becomes visible
+            break;
+        }
+        if (end_of_log) {
+            break;
+        }
+        for (uint32_t block = write.address / (WEAR_LEVELING_INDEX_BLOCK_SIZE); block <= (write.address + write.length - 1) / (WEAR_LEVELING_INDEX_BLOCK_SIZE); ++block) {
+            if (wear_leveling.index[block].last == 0) {
+                wear_leveling.index[block].first = entry_address;
+            }
+            wear_leveling.index[block].last = entry_address;
+        }
+    }
+    wear_leveling.index_address  = log_address;
+    wear_leveling.index_complete = true;
+}
+
+/**
+ * Applies the not yet played back log entries touching the supplied range to data just read from the cache, so that reads during playback see the latest values.
+ */
+static void wear_leveling_read_through(uint32_t address, uint8_t *value, size_t length) {
+    wear_leveling_index_extend();
+
+    // Only the part of the log between the first and last entries touching the read needs decoding, less anything already played back
+    uint32_t from = UINT32_MAX;
+    uint32_t to   = 0;
+    for (uint32_t block = address / (WEAR_LEVELING_INDEX_BLOCK_SIZE); block <= (address + length - 1) / (WEAR_LEVELING_INDEX_BLOCK_SIZE); ++block) {
+        if (wear_leveling.index[block].last < wear_leveling.write_address) {
+            continue;
+        }
+        uint32_t first = wear_leveling.index[block].first > wear_leveling.write_address ? wear_leveling.index[block].first : wear_leveling.write_address;
+        if (first < from) {
+            from = first;
+        }
+        if (wear_leveling.index[block].last > to) {
+            to = wear_leveling.index[block].last;
+        }
+    }
+
+    uint32_t log_address = from;
+    bool     end_of_log  = false;
+    while (log_address <= to) {
+        wear_leveling_log_write_t write;
+        if (wear_leveling_decode_log_entry(&log_address, &write, false, &end_of_log) == WEAR_LEVELING_FAILED || end_of_log) {
+            break;
+        }
+        if (write.address >= address + length || write.address + write.length <= address) {
+            continue;
+        }
+        for (uint8_t i = 0; i < write.length; ++i) {
+            if (write.address + i >= address && write.address + i < address + length) {
+                value[write.address + i - address] = write.data[i];
+            }
+        }
+    }
+}
+
+/**
+ * Finishes any playback still outstanding from an incremental init.
+ */
+static wear_leveling_status_t wear_leveling_playback_finish(void) {
+    if (!wear_leveling.playback_pending) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    bool                   complete;
+    wear_leveling_status_t status = wear_leveling_playback_log_entries(UINT32_MAX, &complete);
+    wear_leveling.playback_pending = false;
+    if (status == WEAR_LEVELING_FAILED) {
+        wear_leveling_clear_cache();
+    }
+    return status;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_PLAYBACK
+
 /**
  * Wear-leveling initialization
  */
@@ -620,6 +792,9 @@ wear_leveling_status_t wear_leveling_init(void) {
 
     // Reset the cache
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    wear_leveling.playback_pending = false;
+#endif
 
     // Initialise the backing store
     if (!backing_store_init()) {
@@ -636,12 +811,17 @@ wear_leveling_status_t wear_leveling_init(void) {
         return status;
     }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    // Reads are served straight away through the read-through index, wear_leveling_task() replays the write log in the background
+    wear_leveling_playback_begin();
+#else
     status = wear_leveling_playback_log();
     if (status == WEAR_LEVELING_FAILED) {
         // If it failed, clear the cache and return with failure
         wear_leveling_clear_cache();
         return status;
     }
+#endif
 
     return status;
 }
@@ -663,6 +843,9 @@ wear_leveling_status_t wear_leveling_erase(void) {
     // Perform the erase
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    wear_leveling.playback_pending = false;
+#endif
 
     // Lock the backing store if we acquired the lock successfully
     if (lock_status == STATUS_SUCCESS) {
@@ -684,6 +867,13 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     wl_dprintf("Write ");
     wl_dump(address, value, length);
 
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    // The cache has to be up to date, and the end of the log known, before anything can be appended
+    if (wear_leveling_playback_finish() == WEAR_LEVELING_FAILED) {
+        return WEAR_LEVELING_FAILED;
+    }
+#endif
+
     // Skip write if there's no change compared to the current cached value
     if (memcmp(value, &wear_leveling.cache[address], length) == 0) {
         return true;
@@ -738,12 +928,60 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
 
     // Only need to copy from the cache
     memcpy(value, &wear_leveling.cache[address], length);
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    // Playback is left to wear_leveling_task(), so that startup reads don't hold up the first matrix scan
+    if (wear_leveling.playback_pending && length > 0) {
+        wear_leveling_read_through(address, value, length);
+    }
+#endif
 
     wl_dprintf("Read  ");
     wl_dump(address, value, length);
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Background processing: incremental playback of the write log, and consolidation once the log passes the configured threshold.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_INCREMENTAL_PLAYBACK
+    if (wear_leveling.playback_pending) {
+        bool                   complete;
+        wear_leveling_status_t status = wear_leveling_playback_log_entries((WEAR_LEVELING_PLAYBACK_CHUNK_SIZE), &complete);
+        if (complete) {
+            wl_dprintf("Incremental playback complete\n");
+            wear_leveling.playback_pending = false;
+            if (status == WEAR_LEVELING_FAILED) {
+                wear_leveling_clear_cache();
+            }
+        }
+        return status;
+    }
+#endif
+
+#if (WEAR_LEVELING_CONSOLIDATE_THRESHOLD) < 100
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    const uint32_t log_size  = (WEAR_LEVELING_BACKING_SIZE) - log_start;
+    if ((uint64_t)(wear_leveling.write_address - log_start) * 100 >= (uint64_t)log_size * (WEAR_LEVELING_CONSOLIDATE_THRESHOLD)) {
+        wl_dprintf("Write log past threshold, consolidating\n");
+        backing_store_lock_status_t lock_status = wear_leveling_unlock();
+        if (lock_status == STATUS_FAILURE) {
+            wear_leveling_lock();
+            return WEAR_LEVELING_FAILED;
+        }
+        wear_leveling_status_t status = wear_leveling_consolidate_force();
+        if (lock_status == STATUS_SUCCESS) {
+            if (wear_leveling_lock() == STATUS_FAILURE) {
+                status = WEAR_LEVELING_FAILED;
+            }
+        }
+        return status;
+    }
+#endif
+
+    return WEAR_LEVELING_SUCCESS;
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
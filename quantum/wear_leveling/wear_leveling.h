@@ -20,6 +20,16 @@ typedef enum wear_leveling_status_t {
  */
 wear_leveling_status_t wear_leveling_init(void);
 
+/**
+ * Wear-leveling background processing.
+ *
+ * Plays back the next chunk of the write log after an incremental init (see WEAR_LEVELING_INCREMENTAL_PLAYBACK), and
+ * consolidates the write log once it passes WEAR_LEVELING_CONSOLIDATE_THRESHOLD percent full.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
 /**
  * Wear-leveling erasure.
  *
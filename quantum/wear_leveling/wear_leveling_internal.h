@@ -25,6 +25,20 @@ typedef uint64_t backing_store_int_t;
 #    error WEAR_LEVELING_LOGICAL_SIZE was not set.
 #endif
 
+#ifndef WEAR_LEVELING_PLAYBACK_CHUNK_SIZE
+#    define WEAR_LEVELING_PLAYBACK_CHUNK_SIZE 32
+#endif
+
+#ifndef WEAR_LEVELING_INDEX_BLOCKS
+#    define WEAR_LEVELING_INDEX_BLOCKS 16
+#endif
+
+#define WEAR_LEVELING_INDEX_BLOCK_SIZE (((WEAR_LEVELING_LOGICAL_SIZE) + (WEAR_LEVELING_INDEX_BLOCKS)-1) / (WEAR_LEVELING_INDEX_BLOCKS))
+
+#ifndef WEAR_LEVELING_CONSOLIDATE_THRESHOLD
+#    define WEAR_LEVELING_CONSOLIDATE_THRESHOLD 100
+#endif
+
 #ifdef WEAR_LEVELING_DEBUG_OUTPUT
 #    include <debug.h>
 #    define bs_dprintf(...) dprintf("Backing store: " __VA_ARGS__)
@@ -63,6 +77,9 @@ typedef uint64_t backing_store_int_t;
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Total backing size must be at least twice the size of the logical size");
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
+STATIC_ASSERT(WEAR_LEVELING_PLAYBACK_CHUNK_SIZE > 0, "Playback chunk size must be at least one log entry");
+STATIC_ASSERT(WEAR_LEVELING_INDEX_BLOCKS > 0, "Read-through index needs at least one block");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATE_THRESHOLD > 0 && WEAR_LEVELING_CONSOLIDATE_THRESHOLD <= 100, "Consolidation threshold must be a percentage between 1 and 100");
 
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
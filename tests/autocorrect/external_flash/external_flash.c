@@ -0,0 +1,99 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "flash.h"
+
+// Memory backed flash, holding autocorrect_data.bin as generated for autocorrect_data.h
+uint8_t external_flash[] = {
+    0x51, 0x4B, 0x41, 0x43, 0x0B, 0x05, 0x00, 0x00, 0x6C, 0x40, 0x00, 0x00, 0x06, 0x5E, 0x00, 0x00, 0x07, 0x68,
+    0x00, 0x00, 0x08, 0x00, 0x01, 0x00, 0x09, 0x4C, 0x02, 0x00, 0x0A, 0x56, 0x02, 0x00, 0x0B, 0x80, 0x02, 0x00,
+    0x11, 0x9D, 0x02, 0x00, 0x12, 0x40, 0x03, 0x00, 0x13, 0x4C, 0x03, 0x00, 0x15, 0x56, 0x03, 0x00, 0x16, 0x9E,
+    0x03, 0x00, 0x17, 0xD0, 0x03, 0x00, 0x1C, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x49, 0x00, 0x00, 0x16, 0x53, 0x00, 0x00, 0x00, 0x0B, 0x17, 0x2C, 0x08, 0x0B, 0x17, 0x2C, 0x00, 0x84,
+    0x00, 0x08, 0x16, 0x12, 0x12, 0x0F, 0x00, 0x84, 0x73, 0x65, 0x73, 0x00, 0x0B, 0x17, 0x0C, 0x1A, 0x16, 0x00,
+    0x81, 0x63, 0x68, 0x00, 0x44, 0x80, 0x00, 0x00, 0x08, 0x8C, 0x00, 0x00, 0x0F, 0xDB, 0x00, 0x00, 0x15, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0F, 0x19, 0x11, 0x0C, 0x00, 0x83, 0x61,
+    0x6C, 0x69, 0x64, 0x00, 0x4A, 0x9D, 0x00, 0x00, 0x0C, 0xA7, 0x00, 0x00, 0x15, 0xB2, 0x00, 0x00, 0x18, 0xC0,
+    0x00, 0x00, 0x00, 0x11, 0x0C, 0x16, 0x00, 0x83, 0x67, 0x6E, 0x65, 0x64, 0x00, 0x19, 0x15, 0x08, 0x07, 0x00,
+    0x83, 0x69, 0x76, 0x65, 0x64, 0x00, 0x48, 0xC9, 0x00, 0x00, 0x18, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0F, 0x06, 0x11, 0x0C, 0x00, 0x81, 0x64, 0x65, 0x00, 0x09, 0x08, 0x15, 0x00, 0x81, 0x72, 0x65,
+    0x64, 0x00, 0x06, 0x06, 0x12, 0x00, 0x81, 0x72, 0x65, 0x64, 0x00, 0x12, 0x16, 0x08, 0x15, 0x0B, 0x17, 0x00,
+    0x82, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x04, 0x1A, 0x12, 0x09, 0x00, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x2D, 0x01, 0x00, 0x06, 0x40,
+    0x01, 0x00, 0x07, 0x4E, 0x01, 0x00, 0x08, 0x5A, 0x01, 0x00, 0x0A, 0x80, 0x01, 0x00, 0x0F, 0x9F, 0x01, 0x00,
+    0x15, 0xA8, 0x01, 0x00, 0x16, 0xC8, 0x01, 0x00, 0x17, 0xE5, 0x01, 0x00, 0x18, 0x31, 0x02, 0x00, 0x19, 0x40,
+    0x02, 0x00, 0x00, 0x06, 0x13, 0x16, 0x08, 0x10, 0x04, 0x11, 0x00, 0x82, 0x61, 0x63, 0x65, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x16, 0x08, 0x10, 0x04, 0x11, 0x00, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00,
+    0x0C, 0x15, 0x08, 0x19, 0x12, 0x00, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x17, 0x00, 0x44, 0x65, 0x01, 0x00,
+    0x11, 0x70, 0x01, 0x00, 0x00, 0x15, 0x04, 0x18, 0x0A, 0x00, 0x82, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x04, 0x15,
+    0x18, 0x04, 0x0A, 0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x44, 0x89, 0x01, 0x00,
+    0x07, 0x93, 0x01, 0x00, 0x00, 0x18, 0x0A, 0x2C, 0x00, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x08, 0x0F, 0x0C,
+    0x19, 0x0C, 0x15, 0x13, 0x00, 0x82, 0x67, 0x65, 0x00, 0x16, 0x04, 0x09, 0x00, 0x82, 0x6C, 0x73, 0x65, 0x00,
+    0x4C, 0xB1, 0x01, 0x00, 0x18, 0xC0, 0x01, 0x00, 0x00, 0x18, 0x14, 0x04, 0x00, 0x84, 0x63, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x17, 0x2C, 0x00, 0x82, 0x72, 0x75, 0x65, 0x00, 0x04, 0x00, 0x4F, 0xD3,
+    0x01, 0x00, 0x18, 0xDB, 0x01, 0x00, 0x00, 0x09, 0x00, 0x83, 0x61, 0x6C, 0x73, 0x65, 0x00, 0x06, 0x08, 0x05,
+    0x00, 0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x00, 0x47, 0xF4, 0x01, 0x00, 0x13, 0x00, 0x02, 0x00, 0x15,
+    0x0A, 0x02, 0x00, 0x00, 0x12, 0x10, 0x00, 0x50, 0x16, 0x02, 0x00, 0x12, 0x25, 0x02, 0x00, 0x00, 0x07, 0x18,
+    0x00, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x08, 0x13, 0x08, 0x16, 0x00, 0x84, 0x61, 0x72, 0x61, 0x74,
+    0x65, 0x00, 0x12, 0x06, 0x04, 0x00, 0x87, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x06,
+    0x06, 0x04, 0x00, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x0A, 0x08, 0x0F, 0x0F, 0x12, 0x06, 0x00,
+    0x82, 0x61, 0x67, 0x75, 0x65, 0x00, 0x00, 0x00, 0x08, 0x0C, 0x06, 0x08, 0x15, 0x00, 0x83, 0x65, 0x69, 0x76,
+    0x65, 0x00, 0x0C, 0x08, 0x0B, 0x06, 0x00, 0x82, 0x69, 0x65, 0x66, 0x00, 0x11, 0x00, 0x4C, 0x61, 0x02, 0x00,
+    0x15, 0x6E, 0x02, 0x00, 0x00, 0x0F, 0x08, 0x0C, 0x06, 0x00, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x00,
+    0x0C, 0x17, 0x16, 0x00, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x89, 0x02, 0x00, 0x17, 0x94, 0x02, 0x00, 0x00, 0x0C, 0x17, 0x1A, 0x16, 0x00, 0x83, 0x69, 0x74, 0x63,
+    0x68, 0x00, 0x0A, 0x0C, 0x08, 0x0B, 0x00, 0x81, 0x68, 0x74, 0x00, 0x48, 0xB2, 0x02, 0x00, 0x0A, 0xC0, 0x02,
+    0x00, 0x12, 0xC9, 0x02, 0x00, 0x15, 0x19, 0x03, 0x00, 0x18, 0x24, 0x03, 0x00, 0x00, 0x16, 0x12, 0x12, 0x0B,
+    0x06, 0x00, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x15, 0x17, 0x16, 0x00, 0x81, 0x6E, 0x67,
+    0x00, 0x0C, 0x00, 0x56, 0xD4, 0x02, 0x00, 0x17, 0xDD, 0x02, 0x00, 0x00, 0x44, 0xE6, 0x02, 0x00, 0x16, 0xEF,
+    0x02, 0x00, 0x00, 0x4C, 0x00, 0x03, 0x00, 0x16, 0x0F, 0x03, 0x00, 0x00, 0x0C, 0x0F, 0x00, 0x83, 0x69, 0x73,
+    0x6F, 0x6E, 0x00, 0x04, 0x06, 0x06, 0x12, 0x00, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x17, 0x0C, 0x13, 0x08, 0x15, 0x00, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x12,
+    0x13, 0x00, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x17, 0x18, 0x08, 0x15, 0x00, 0x83, 0x74, 0x75, 0x72,
+    0x6E, 0x00, 0x55, 0x2D, 0x03, 0x00, 0x17, 0x36, 0x03, 0x00, 0x00, 0x17, 0x08, 0x15, 0x00, 0x82, 0x75, 0x72,
+    0x6E, 0x00, 0x08, 0x15, 0x00, 0x80, 0x72, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x18, 0x16, 0x13, 0x00,
+    0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x18, 0x12, 0x12, 0x0F, 0x00, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x48, 0x5F,
+    0x03, 0x00, 0x12, 0x6C, 0x03, 0x00, 0x00, 0x4C, 0x80, 0x03, 0x00, 0x0F, 0x89, 0x03, 0x00, 0x11, 0x93, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x15, 0x08, 0x17, 0x11, 0x0C, 0x00, 0x87, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x17, 0x2C, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x17, 0x0C, 0x09, 0x00, 0x83,
+    0x6C, 0x74, 0x65, 0x72, 0x00, 0x17, 0x16, 0x0C, 0x0F, 0x00, 0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x48, 0xAB,
+    0x03, 0x00, 0x11, 0xB3, 0x03, 0x00, 0x18, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x04, 0x09, 0x00, 0x81, 0x73, 0x65,
+    0x00, 0x04, 0x0C, 0x17, 0x11, 0x12, 0x06, 0x00, 0x83, 0x61, 0x69, 0x6E, 0x73, 0x00, 0x16, 0x11, 0x08, 0x06,
+    0x11, 0x12, 0x06, 0x00, 0x85, 0x73, 0x65, 0x6E, 0x73, 0x75, 0x73, 0x00, 0x4A, 0xE9, 0x03, 0x00, 0x0B, 0xF3,
+    0x03, 0x00, 0x0F, 0x00, 0x04, 0x00, 0x11, 0x0B, 0x04, 0x00, 0x16, 0x70, 0x04, 0x00, 0x18, 0x80, 0x04, 0x00,
+    0x00, 0x0B, 0x18, 0x04, 0x06, 0x00, 0x82, 0x67, 0x68, 0x74, 0x00, 0x47, 0xAC, 0x04, 0x00, 0x0A, 0xB3, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x18, 0x08, 0x15, 0x00, 0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x44,
+    0x18, 0x04, 0x00, 0x08, 0x23, 0x04, 0x00, 0x16, 0x2C, 0x04, 0x00, 0x00, 0x15, 0x04, 0x13, 0x13, 0x04, 0x00,
+    0x82, 0x65, 0x6E, 0x74, 0x00, 0x55, 0x34, 0x04, 0x00, 0x19, 0x40, 0x04, 0x00, 0x00, 0x12, 0x06, 0x00, 0x82,
+    0x6E, 0x73, 0x74, 0x00, 0x44, 0x4A, 0x04, 0x00, 0x15, 0x55, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0F,
+    0x08, 0x15, 0x00, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x13, 0x04, 0x00, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+    0x00, 0x04, 0x13, 0x00, 0x44, 0x61, 0x04, 0x00, 0x13, 0x69, 0x04, 0x00, 0x00, 0x85, 0x70, 0x61, 0x72, 0x65,
+    0x6E, 0x74, 0x00, 0x04, 0x00, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x0C, 0x09, 0x08, 0x11, 0x04, 0x10, 0x00, 0x84,
+    0x69, 0x66, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x53, 0x89, 0x04, 0x00, 0x17, 0x92, 0x04, 0x00, 0x00, 0x57,
+    0x9C, 0x04, 0x00, 0x18, 0xA4, 0x04, 0x00, 0x00, 0x13, 0x18, 0x12, 0x00, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00,
+    0x11, 0x0C, 0x00, 0x83, 0x70, 0x75, 0x74, 0x00, 0x12, 0x00, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x0C, 0x1A,
+    0x00, 0x81, 0x74, 0x68, 0x00, 0x11, 0x08, 0x0F, 0x00, 0x81, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0xD1, 0x04, 0x00, 0x08, 0xDD, 0x04, 0x00, 0x0B, 0xE7, 0x04, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x08,
+    0x18, 0x14, 0x08, 0x15, 0x09, 0x00, 0x81, 0x6E, 0x63, 0x79, 0x00, 0x17, 0x09, 0x04, 0x16, 0x00, 0x82, 0x65,
+    0x74, 0x79, 0x00, 0x06, 0x15, 0x04, 0x15, 0x0C, 0x08, 0x0B, 0x00, 0x87, 0x69, 0x65, 0x72, 0x61, 0x72, 0x63,
+    0x68, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x05, 0x0C, 0x0F, 0x00, 0x82, 0x72, 0x61,
+    0x72, 0x79, 0x00
+};
+
+uint32_t external_flash_reads = 0;
+bool     external_flash_fail  = false;
+
+void flash_init(void) {}
+
+flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
+    external_flash_reads++;
+    if (external_flash_fail) {
+        return FLASH_STATUS_ERROR;
+    }
+    if (addr + len > sizeof(external_flash)) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    memcpy(buf, external_flash + addr, len);
+    return FLASH_STATUS_SUCCESS;
+}
@@ -0,0 +1,148 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include "../test_autocorrect.cpp"
+
+extern "C" {
+extern uint8_t  external_flash[];
+extern uint32_t external_flash_reads;
+extern bool     external_flash_fail;
+}
+
+using ::testing::AnyNumber;
+
+class AutoCorrectExternalFlash : public AutoCorrect {
+   public:
+    void SetUp() override {
+        external_flash[0]   = 'Q';
+        external_flash_fail = false;
+        AutoCorrect::SetUp();
+    }
+
+    // Types `text` straight into process_autocorrect(), returning the number of flash reads per keystroke.
+    std::vector<uint32_t> Type(const char *text) {
+        std::vector<uint32_t> reads;
+        keyrecord_t           record = {};
+        record.event.pressed         = true;
+        for (const char *c = text; *c; ++c) {
+            uint32_t before = external_flash_reads;
+            process_autocorrect(*c == ' ' ? KC_SPC : KC_A + (*c - 'a'), &record);
+            reads.push_back(external_flash_reads - before);
+        }
+        return reads;
+    }
+};
+
+// Test that a word typed twice is served from the page cache the second time
+TEST_F(AutoCorrectExternalFlash, cache_serves_repeated_lookups) {
+    TestDriver driver;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+    Type(" fales");
+    for (uint32_t reads : Type(" fales")) {
+        EXPECT_EQ(reads, 0);
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that a dictionary with a bad header is not walked, and only the header is read
+TEST_F(AutoCorrectExternalFlash, invalid_header_disables_lookups) {
+    TestDriver driver;
+    auto       key_f = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s = KeymapKey(0, 4, 0, KC_S);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+    }
+
+    external_flash[0] = 0xFF;
+    autocorrect_enable();
+    uint32_t before = external_flash_reads;
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+    EXPECT_EQ(external_flash_reads - before, 1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that a failed read skips the correction, and the dictionary is used again once reads succeed
+TEST_F(AutoCorrectExternalFlash, read_failure_recovers) {
+    TestDriver driver;
+    auto       key_f     = KeymapKey(0, 0, 0, KC_F);
+    auto       key_a     = KeymapKey(0, 1, 0, KC_A);
+    auto       key_l     = KeymapKey(0, 2, 0, KC_L);
+    auto       key_e     = KeymapKey(0, 3, 0, KC_E);
+    auto       key_s     = KeymapKey(0, 4, 0, KC_S);
+    auto       key_space = KeymapKey(0, 5, 0, KC_SPACE);
+
+    set_keymap({key_f, key_a, key_l, key_e, key_s, key_space});
+
+    // Allow any number of empty reports.
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_SPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+
+    external_flash_fail = true;
+    TapKeys(key_f, key_a, key_l, key_e, key_s, key_space);
+    external_flash_fail = false;
+    TapKeys(key_f, key_a, key_l, key_e, key_s);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Measures flash reads and time spent in process_autocorrect() per keystroke while typing prose
+TEST_F(AutoCorrectExternalFlash, lookup_latency) {
+    TestDriver driver;
+    // Correctly spelled, so that only lookups are timed and not the corrections they would send
+    const char text[] = " the listener received the output of the iterator before the return and it is not their length"
+                        " while the namespace is the filter for every update of the configuration by separate threads";
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    constexpr int         passes = 1000;
+    std::vector<uint32_t> reads  = Type(text);
+    auto                  start  = std::chrono::steady_clock::now();
+    for (int i = 1; i < passes; ++i) {
+        Type(text);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t total = 0, worst = 0;
+    for (uint32_t r : reads) {
+        total += r;
+        worst = std::max(worst, r);
+    }
+    printf("[ LATENCY  ] %.0f ns per keystroke (warm), first pass %.2f flash reads per keystroke, at most %u\n", elapsed / ((passes - 1) * (sizeof(text) - 1)), (double)total / reads.size(), worst);
+
+    // Only the pages on the path of a single lookup may be missing from the cache
+    EXPECT_LE(worst, 4);
+
+    VERIFY_AND_CLEAR(driver);
+}
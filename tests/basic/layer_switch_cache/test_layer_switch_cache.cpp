@@ -0,0 +1,157 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerSwitchCache : public TestFixture {
+   protected:
+    /* Uncached reference: topmost active layer with a non-transparent action. */
+    static uint8_t uncached_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void expect_all_keys_match(void) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                EXPECT_EQ(layer_switch_get_layer(key), uncached_layer(key)) << "row " << +row << " col " << +col << " layer_state " << layer_state << " default_layer_state " << default_layer_state;
+            }
+        }
+    }
+
+    void set_layered_keymap(void) {
+        /* Every position gets a different mix of transparent and opaque layers. */
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                uint8_t pattern = (row * MATRIX_COLS + col) % 16;
+                for (uint8_t layer = 0; layer < 4; layer++) {
+                    add_key(KeymapKey(layer, col, row, (pattern & (1 << layer)) ? KC_A + layer : KC_TRNS));
+                }
+            }
+        }
+    }
+};
+
+TEST_F(LayerSwitchCache, MatchesUncachedLookupForAllLayerStates) {
+    TestDriver driver;
+
+    set_layered_keymap();
+
+    for (layer_state_t default_state = 1; default_state < 16; default_state <<= 1) {
+        default_layer_set(default_state);
+        for (layer_state_t state = 0; state < 16; state++) {
+            layer_state_set(state);
+            expect_all_keys_match();
+            /* Second pass is served from the cache. */
+            expect_all_keys_match();
+        }
+    }
+    default_layer_set(1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, RepeatedLookupsHitTheCache) {
+    TestDriver driver;
+    keypos_t   key = {.col = 3, .row = 1};
+
+    set_layered_keymap();
+    layer_state_set(0b0110);
+
+    layer_switch_cache_stats_t before = layer_switch_cache_get_stats();
+    layer_switch_get_layer(key);
+    layer_switch_get_layer(key);
+    layer_switch_get_layer(key);
+    layer_switch_cache_stats_t after = layer_switch_cache_get_stats();
+
+    EXPECT_EQ(after.misses - before.misses, 1);
+    EXPECT_EQ(after.hits - before.hits, 2);
+
+    layer_state_set(0b0010);
+    EXPECT_EQ(layer_switch_cache_get_stats().invalidations - after.invalidations, 1);
+    EXPECT_EQ(layer_switch_get_layer(key), uncached_layer(key));
+    EXPECT_EQ(layer_switch_cache_get_stats().misses - after.misses, 1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, DirectLayerStateWriteIsDetected) {
+    TestDriver driver;
+
+    set_layered_keymap();
+    layer_state_set(0b1000);
+    expect_all_keys_match();
+
+    /* Split keyboards synchronise layer_state without going through layer_state_set(). */
+    layer_state = 0b0100;
+    expect_all_keys_match();
+
+    layer_state_set(0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, KeymapChangeIsPickedUp) {
+    TestDriver driver;
+    auto       key_a     = KeymapKey(0, 0, 0, KC_A);
+    auto       key_trans = KeymapKey(1, 0, 0, KC_TRNS);
+
+    set_keymap({key_a, key_trans});
+    layer_state_set(0b10);
+
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    set_keymap({key_a, KeymapKey(1, 0, 0, KC_B)});
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_state_set(0);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, MomentaryLayerReleasesCachedKey) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       regular   = KeymapKey(0, 1, 0, KC_A);
+    auto       layered   = KeymapKey(1, 1, 0, KC_B);
+
+    set_keymap({layer_key, regular, layered, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    /* Prime the cache with the base layer resolution. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    regular.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
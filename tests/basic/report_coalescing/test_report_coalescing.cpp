@@ -0,0 +1,225 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_util.h"
+
+using testing::_;
+using testing::Field;
+using testing::InSequence;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == QK_USER_0 && record->event.pressed) {
+        tap_code(KC_A);
+        wait_ms(1000);
+        tap_code(KC_B);
+        return false;
+    }
+    return true;
+}
+
+class ReportCoalescing : public TestFixture {};
+
+TEST_F(ReportCoalescing, KeysPressedInTheSameScanSendOneReport) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 0, 0, KC_B);
+    auto       key_c = KeymapKey(0, 1, 0, KC_C);
+    auto       key_d = KeymapKey(0, 0, 1, KC_D);
+
+    set_keymap({key_b, key_c, key_d});
+
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    EXPECT_REPORT(driver, (key_b.report_code, key_c.report_code, key_d.report_code)).Times(1);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, ModifiersPressedInTheSameScanSendOneReport) {
+    TestDriver driver;
+    auto       key_lsft  = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_lctrl = KeymapKey(0, 1, 0, KC_LEFT_CTRL);
+
+    set_keymap({key_lsft, key_lctrl});
+
+    key_lsft.press();
+    key_lctrl.press();
+    EXPECT_REPORT(driver, (key_lsft.report_code, key_lctrl.report_code)).Times(1);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_lsft.release();
+    key_lctrl.release();
+    EXPECT_EMPTY_REPORT(driver).Times(1);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, ModifierBeforeKeyKeepsItsOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_lsft = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto       key_a    = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_lsft, key_a});
+
+    key_lsft.press();
+    key_a.press();
+    EXPECT_REPORT(driver, (key_lsft.report_code));
+    EXPECT_REPORT(driver, (key_lsft.report_code, key_a.report_code));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Releases merge, the host never sees A without Shift */
+    key_lsft.release();
+    key_a.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, KeyBeforeModifierKeepsItsOrder) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a    = KeymapKey(0, 0, 0, KC_A);
+    auto       key_lsft = KeymapKey(0, 1, 0, KC_LEFT_SHIFT);
+
+    set_keymap({key_a, key_lsft});
+
+    key_a.press();
+    key_lsft.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_REPORT(driver, (key_a.report_code, key_lsft.report_code));
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_lsft.release();
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, TapWithinOneScanIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    auto       key_b       = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({mod_tap_key, key_b});
+
+    mod_tap_key.press();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The tap is resolved on release, P is registered and unregistered during the same scan as B is pressed. P has to
+     * reach the host on its own, its release can go along with pressing B. */
+    mod_tap_key.release();
+    key_b.press();
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_REPORT(driver, (key_b.report_code));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_b.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, NestedTransactionsSendOnOutermostCommit) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_NO_REPORT(driver);
+    keyboard_report_begin();
+    keyboard_report_begin();
+    register_code(KC_A);
+    register_code(KC_B);
+    keyboard_report_commit();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    keyboard_report_commit();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, FlushSendsThePendingReport) {
+    TestDriver driver;
+    InSequence s;
+
+    keyboard_report_begin();
+    EXPECT_REPORT(driver, (KC_A));
+    register_code(KC_A);
+    keyboard_report_flush();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    register_code(KC_B);
+    keyboard_report_commit();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    clear_keyboard();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, MacroDelaySendsThePendingReportFirst) {
+    TestDriver driver;
+    InSequence s;
+    auto       macro_key = KeymapKey(0, 0, 0, QK_USER_0);
+
+    set_keymap({macro_key});
+
+    /* A's release has to reach the host before the macro waits, not together with B once the scan is done */
+    uint32_t start = timer_read32();
+    macro_key.press();
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver).WillOnce([start](report_keyboard_t &) { EXPECT_EQ(timer_read32(), start); });
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    macro_key.release();
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ReportCoalescing, KeyboardReportIsSentBeforeConsumerReport) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a    = KeymapKey(0, 0, 0, KC_A);
+    auto       key_mute = KeymapKey(0, 1, 0, KC_AUDIO_MUTE);
+
+    set_keymap({key_a, key_mute});
+
+    key_a.press();
+    key_mute.press();
+    EXPECT_REPORT(driver, (key_a.report_code));
+    EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, AUDIO_MUTE)));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    key_mute.release();
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_CALL(driver, send_extra_mock(Field(&report_extra_t::usage, 0)));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,51 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "benchmark_keymap.h"
+
+// A handful of each, so every lookup walks more than a single entry like a real keymap would.
+
+const uint16_t PROGMEM jk_combo[]   = {KC_J, KC_K, COMBO_END};
+const uint16_t PROGMEM df_combo[]   = {LCTL_T(KC_D), LSFT_T(KC_F), COMBO_END};
+const uint16_t PROGMEM we_combo[]   = {KC_W, KC_E, COMBO_END};
+const uint16_t PROGMEM io_combo[]   = {KC_I, KC_O, COMBO_END};
+const uint16_t PROGMEM xc_combo[]   = {KC_X, KC_C, COMBO_END};
+const uint16_t PROGMEM cv_combo[]   = {KC_C, KC_V, COMBO_END};
+const uint16_t PROGMEM mcom_combo[] = {KC_M, KC_COMM, COMBO_END};
+const uint16_t PROGMEM uio_combo[]  = {KC_U, KC_I, KC_O, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(df_combo, KC_TAB),
+    COMBO(we_combo, KC_LBRC),
+    COMBO(io_combo, KC_RBRC),
+    COMBO(xc_combo, LCTL(KC_C)),
+    COMBO(cv_combo, LCTL(KC_V)),
+    COMBO(mcom_combo, KC_ENT),
+    COMBO(uio_combo, KC_BSLS),
+};
+// clang-format on
+
+const key_override_t shift_bspc_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t shift_comm_override = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t shift_dot_override  = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+const key_override_t ctrl_h_override     = ko_make_basic(MOD_MASK_CTRL, KC_H, KC_LEFT);
+const key_override_t ctrl_l_override     = ko_make_basic(MOD_MASK_CTRL, KC_L, KC_RGHT);
+const key_override_t gui_q_override      = ko_make_basic(MOD_MASK_GUI, KC_Q, KC_F4);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_bspc_override,
+    &shift_comm_override,
+    &shift_dot_override,
+    &ctrl_h_override,
+    &ctrl_l_override,
+    &gui_q_override,
+};
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_ESC_CAPS]  = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
+    [TD_LBRC_RBRC] = ACTION_TAP_DANCE_DOUBLE(KC_LBRC, KC_RBRC),
+};
+// clang-format on
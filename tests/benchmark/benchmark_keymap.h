@@ -0,0 +1,9 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+enum benchmark_tap_dances {
+    TD_ESC_CAPS,
+    TD_LBRC_RBRC,
+};
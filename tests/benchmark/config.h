@@ -0,0 +1,19 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t benchmark_timestamp(void);
+#ifdef __cplusplus
+}
+#endif
+
+/* The virtual millisecond timer drives the keyboard, the profiler measures host nanoseconds instead. */
+#define PROFILER_TIMESTAMP_GETTER benchmark_timestamp()
+#define PROFILER_HISTOGRAM_BUCKETS 32
@@ -0,0 +1,180 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_env.hpp"
+#include "benchmark_keymap.h"
+
+extern "C" {
+#include "host.h"
+#include "profiler.h"
+#include "process_autocorrect.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+extern "C" uint32_t benchmark_timestamp(void) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Counts reports instead of matching them, so the mocks and the test logger don't dominate the measurement. */
+static uint32_t report_count = 0;
+
+static uint8_t benchmark_keyboard_leds(void) {
+    return 0;
+}
+static void benchmark_send_keyboard(report_keyboard_t* report) {
+    report_count++;
+}
+static void benchmark_send_nkro(report_nkro_t* report) {
+    report_count++;
+}
+static void benchmark_send_mouse(report_mouse_t* report) {}
+static void benchmark_send_extra(report_extra_t* report) {}
+
+static host_driver_t benchmark_driver = {benchmark_keyboard_leds, benchmark_send_keyboard, benchmark_send_nkro, benchmark_send_mouse, benchmark_send_extra};
+
+struct trace_event_t {
+    uint32_t time;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/**
+ * Reads a matrix event trace: one event per line as "<time ms> <row> <col> <1 pressed | 0 released>", in chronological
+ * order. Lines starting with '#' are comments.
+ */
+static std::vector<trace_event_t> load_trace(const std::string& path) {
+    std::vector<trace_event_t> events;
+    std::ifstream              file(path);
+    std::string                line;
+
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        unsigned           time, row, col, pressed;
+        if (!(fields >> time >> row >> col >> pressed) || row >= MATRIX_ROWS || col >= MATRIX_COLS || (!events.empty() && time < events.back().time)) {
+            ADD_FAILURE() << path << ": invalid event \"" << line << "\"";
+            return {};
+        }
+        events.push_back({time, (uint8_t)row, (uint8_t)col, pressed != 0});
+    }
+    return events;
+}
+
+struct subsystem_t {
+    const char*              name;
+    std::vector<const char*> probes;
+};
+
+/* Self time of the probes is used, so time spent in nested probes, e.g. a combo firing its key, counts only once. */
+static const std::vector<subsystem_t> subsystems = {
+    {"tapping", {"action_tapping_process"}},
+    {"combos", {"process_combo", "combo_task"}},
+    {"key overrides", {"process_key_override", "key_override_task"}},
+    {"tap dance", {"preprocess_tap_dance", "process_tap_dance", "tap_dance_task"}},
+    {"autocorrect", {"process_autocorrect"}},
+    {"process_record", {"process_record_quantum", "process_record_handler"}},
+};
+
+class Benchmark : public TestFixture {
+   protected:
+    void SetUp() override {
+        // clang-format off
+        set_keymap({
+            KeymapKey(0, 0, 0, KC_Q), KeymapKey(0, 1, 0, KC_W), KeymapKey(0, 2, 0, KC_E), KeymapKey(0, 3, 0, KC_R), KeymapKey(0, 4, 0, KC_T),
+            KeymapKey(0, 5, 0, KC_Y), KeymapKey(0, 6, 0, KC_U), KeymapKey(0, 7, 0, KC_I), KeymapKey(0, 8, 0, KC_O), KeymapKey(0, 9, 0, KC_P),
+            KeymapKey(0, 0, 1, LGUI_T(KC_A)), KeymapKey(0, 1, 1, LALT_T(KC_S)), KeymapKey(0, 2, 1, LCTL_T(KC_D)), KeymapKey(0, 3, 1, LSFT_T(KC_F)), KeymapKey(0, 4, 1, KC_G),
+            KeymapKey(0, 5, 1, KC_H), KeymapKey(0, 6, 1, KC_J), KeymapKey(0, 7, 1, KC_K), KeymapKey(0, 8, 1, KC_L), KeymapKey(0, 9, 1, KC_BSPC),
+            KeymapKey(0, 0, 2, KC_Z), KeymapKey(0, 1, 2, KC_X), KeymapKey(0, 2, 2, KC_C), KeymapKey(0, 3, 2, KC_V), KeymapKey(0, 4, 2, KC_B),
+            KeymapKey(0, 5, 2, KC_N), KeymapKey(0, 6, 2, KC_M), KeymapKey(0, 7, 2, KC_COMM), KeymapKey(0, 8, 2, KC_DOT), KeymapKey(0, 9, 2, KC_SLSH),
+            KeymapKey(0, 0, 3, KC_LSFT), KeymapKey(0, 1, 3, TD(TD_ESC_CAPS)), KeymapKey(0, 2, 3, KC_SPC), KeymapKey(0, 3, 3, KC_ENT), KeymapKey(0, 4, 3, KC_LCTL),
+            KeymapKey(0, 5, 3, TD(TD_LBRC_RBRC)), KeymapKey(0, 6, 3, KC_QUOT), KeymapKey(0, 7, 3, KC_MINS), KeymapKey(0, 8, 3, KC_EQL), KeymapKey(0, 9, 3, KC_RSFT),
+        });
+        // clang-format on
+        autocorrect_enable();
+    }
+
+    void TearDown() override {
+        autocorrect_disable();
+    }
+
+    /* Same as idle_for(), without logging every call. */
+    void scan(uint32_t& now, uint32_t until) {
+        for (; now < until; now++) {
+            keyboard_task();
+            housekeeping_task();
+            advance_time(1);
+        }
+    }
+};
+
+/**
+ * Replays tests/benchmark/traces/typing.trace, or the trace given by BENCHMARK_TRACE, BENCHMARK_REPEAT times (default 1)
+ * with the matrix scanned every virtual millisecond. Prints events per second, nanoseconds per event and how they split
+ * into the subsystems. BENCHMARK_MAX_NS_PER_EVENT makes the test fail above the given cost.
+ */
+TEST_F(Benchmark, ReplayTrace) {
+    const char* path   = std::getenv("BENCHMARK_TRACE");
+    std::string trace  = path ? path : std::string(__FILE__).substr(0, std::string(__FILE__).find_last_of('/')) + "/traces/typing.trace";
+    unsigned    repeat = env_or("BENCHMARK_REPEAT", 1);
+
+    auto events = load_trace(trace);
+    ASSERT_FALSE(events.empty()) << "no events in " << trace;
+
+    host_driver_t* previous_driver = host_get_driver();
+    host_set_driver(&benchmark_driver);
+    report_count = 0;
+    profiler_reset();
+
+    uint32_t now   = 0;
+    auto     start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < repeat; i++) {
+        uint32_t base = now;
+        for (const auto& event : events) {
+            scan(now, base + event.time);
+            event.pressed ? press_key(event.col, event.row) : release_key(event.col, event.row);
+        }
+        // Let taps, combos and tap dances still waiting for their timeout resolve
+        scan(now, now + TAPPING_TERM * 2);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    host_set_driver(previous_driver);
+
+    uint64_t event_count = (uint64_t)events.size() * repeat;
+    double   ns_event    = (double)elapsed / event_count;
+    printf("trace:        %s\n", trace.c_str());
+    printf("events:       %llu in %lu scans, %lu reports\n", (unsigned long long)event_count, (unsigned long)now, (unsigned long)report_count);
+    printf("events/sec:   %.0f\n", event_count * 1e9 / elapsed);
+    printf("ns/event:     %.0f (%.0f ns/scan)\n", ns_event, (double)elapsed / now);
+    printf("%-16s %10s %10s %10s\n", "subsystem", "calls", "ns/call", "ns/event");
+    for (const auto& subsystem : subsystems) {
+        uint64_t calls = 0, self = 0;
+        for (const char* name : subsystem.probes) {
+            profiler_probe_t* probe = profiler_find_probe(name);
+            if (probe) {
+                calls += probe->count;
+                self += probe->self;
+            }
+        }
+        printf("%-16s %10llu %10.0f %10.1f\n", subsystem.name, (unsigned long long)calls, calls ? (double)self / calls : 0.0, (double)self / event_count);
+        EXPECT_GT(calls, 0) << subsystem.name << " was not exercised by the trace";
+    }
+
+    unsigned limit = env_or("BENCHMARK_MAX_NS_PER_EVENT", 0);
+    if (limit) {
+        EXPECT_LE(ns_event, limit) << "replay got slower than BENCHMARK_MAX_NS_PER_EVENT";
+    }
+}
@@ -0,0 +1,45 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "generated_combos.h"
+
+// Filled by the suite's process_combo_event()
+extern std::vector<std::pair<uint16_t, bool>> combo_events;
+
+// Times a non-combo key tap followed by a combo against the generated combos. Shared with the linear_scan suite,
+// built without COMBO_KEY_INDEX_SIZE, so both figures can be compared.
+static inline void measure_per_event_cost(TestFixture &fixture, const char *lookup) {
+    TestDriver driver;
+    KeymapKey  key_f5(0, 0, 0, KC_F5);
+    KeymapKey  key_x(0, 1, 0, KC_X);
+    KeymapKey  key_y(0, 2, 0, KC_Y);
+    fixture.set_keymap({key_f5, key_x, key_y});
+
+    EXPECT_REPORT(driver, (KC_F5)).Times(testing::AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(testing::AnyNumber());
+
+    constexpr unsigned iterations = 1000;
+    auto               start      = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        fixture.tap_key(key_f5);
+        fixture.tap_combo({key_x, key_y});
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(combo_events.size(), iterations * 2);
+    // Each iteration is four key events; include the scan loops in the figure.
+    std::cout << "[ COMBOS   ] " << GENERATED_COMBO_COUNT << " combos, " << lookup << ": " << (elapsed / (iterations * 4)) << " ns per key event" << std::endl;
+}
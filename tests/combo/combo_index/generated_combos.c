@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "generated_combos.h"
+
+static uint16_t generated_keys[GENERATED_COMBO_COUNT][3];
+static combo_t  generated_combos[GENERATED_COMBO_COUNT];
+
+void generate_combos(void) {
+    uint16_t idx = 0;
+    for (uint16_t a = 0; a < GENERATED_COMBO_KEYCODES; ++a) {
+        for (uint16_t b = a + 1; b < GENERATED_COMBO_KEYCODES; ++b) {
+            generated_keys[idx][0] = GENERATED_COMBO_FIRST_KEYCODE + a;
+            generated_keys[idx][1] = GENERATED_COMBO_FIRST_KEYCODE + b;
+            generated_keys[idx][2] = COMBO_END;
+            generated_combos[idx]  = (combo_t)COMBO_ACTION(generated_keys[idx]);
+            ++idx;
+        }
+    }
+    combo_key_index_invalidate();
+}
+
+uint16_t generated_combo_index(uint16_t keycode_a, uint16_t keycode_b) {
+    uint16_t a = MIN(keycode_a, keycode_b) - GENERATED_COMBO_FIRST_KEYCODE;
+    uint16_t b = MAX(keycode_a, keycode_b) - GENERATED_COMBO_FIRST_KEYCODE;
+    // Skip the rows for all smaller first keys, then the offset within row a.
+    return a * (2 * GENERATED_COMBO_KEYCODES - a - 1) / 2 + (b - a - 1);
+}
+
+uint16_t combo_count(void) {
+    return GENERATED_COMBO_COUNT;
+}
+
+combo_t *combo_get(uint16_t combo_idx) {
+    if (combo_idx >= GENERATED_COMBO_COUNT) {
+        return NULL;
+    }
+    return &generated_combos[combo_idx];
+}
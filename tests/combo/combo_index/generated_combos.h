@@ -0,0 +1,23 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GENERATED_COMBO_FIRST_KEYCODE KC_A
+#define GENERATED_COMBO_KEYCODES 36 // KC_A ... KC_0
+#define GENERATED_COMBO_COUNT ((GENERATED_COMBO_KEYCODES * (GENERATED_COMBO_KEYCODES - 1)) / 2)
+
+// Build one combo per unordered pair of keycodes and invalidate the combo key index.
+void generate_combos(void);
+// Index of the generated combo made of the two keycodes.
+uint16_t generated_combo_index(uint16_t keycode_a, uint16_t keycode_b);
+
+#ifdef __cplusplus
+}
+#endif
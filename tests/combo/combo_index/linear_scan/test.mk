@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The combo_index tests without COMBO_KEY_INDEX_SIZE, as a baseline for the indexed lookup
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos_index.c
+
+SRC += ../generated_combos.c
@@ -0,0 +1,38 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../combo_index_benchmark.hpp"
+
+using testing::_;
+
+std::vector<std::pair<uint16_t, bool>> combo_events;
+
+extern "C" void process_combo_event(uint16_t combo_index, bool pressed) {
+    combo_events.emplace_back(combo_index, pressed);
+}
+
+class ComboLinearScan : public TestFixture {
+   public:
+    ComboLinearScan() {
+        generate_combos();
+        combo_events.clear();
+    }
+};
+
+TEST_F(ComboLinearScan, fires_matching_combo_from_large_table) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    KeymapKey  key_k(0, 1, 0, KC_K);
+    set_keymap({key_j, key_k});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_k, key_j});
+    VERIFY_AND_CLEAR(driver);
+
+    std::vector<std::pair<uint16_t, bool>> expected = {{generated_combo_index(KC_J, KC_K), true}, {generated_combo_index(KC_J, KC_K), false}};
+    EXPECT_EQ(combo_events, expected);
+}
+
+TEST_F(ComboLinearScan, per_event_cost) {
+    measure_per_event_cost(*this, "linear scan");
+}
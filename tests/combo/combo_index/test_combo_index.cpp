@@ -0,0 +1,88 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+#include "combo_index_benchmark.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+std::vector<std::pair<uint16_t, bool>> combo_events;
+
+extern "C" void process_combo_event(uint16_t combo_index, bool pressed) {
+    combo_events.emplace_back(combo_index, pressed);
+}
+
+class ComboIndex : public TestFixture {
+   public:
+    ComboIndex() {
+        generate_combos();
+        combo_events.clear();
+    }
+};
+
+TEST_F(ComboIndex, fires_matching_combo_from_large_table) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_b(0, 1, 0, KC_B);
+    KeymapKey  key_j(0, 2, 0, KC_J);
+    KeymapKey  key_k(0, 3, 0, KC_K);
+    KeymapKey  key_9(0, 4, 0, KC_9);
+    KeymapKey  key_0(0, 5, 0, KC_0);
+    set_keymap({key_a, key_b, key_j, key_k, key_9, key_0});
+
+    ASSERT_GE(GENERATED_COMBO_COUNT, 500);
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_a, key_b});
+    tap_combo({key_k, key_j});
+    tap_combo({key_9, key_0});
+    VERIFY_AND_CLEAR(driver);
+
+    std::vector<std::pair<uint16_t, bool>> expected = {
+        {generated_combo_index(KC_A, KC_B), true},
+        {generated_combo_index(KC_A, KC_B), false},
+        {generated_combo_index(KC_J, KC_K), true},
+        {generated_combo_index(KC_J, KC_K), false},
+        {generated_combo_index(KC_9, KC_0), true},
+        {generated_combo_index(KC_9, KC_0), false},
+    };
+    EXPECT_EQ(combo_events, expected);
+    EXPECT_EQ(generated_combo_index(KC_9, KC_0), GENERATED_COMBO_COUNT - 1);
+}
+
+TEST_F(ComboIndex, combo_key_pressed_alone_is_sent) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    set_keymap({key_j});
+
+    EXPECT_REPORT(driver, (KC_J));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_j);
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(combo_events.empty());
+}
+
+TEST_F(ComboIndex, non_combo_key_is_sent) {
+    TestDriver driver;
+    KeymapKey  key_f5(0, 0, 0, KC_F5);
+    set_keymap({key_f5});
+
+    EXPECT_REPORT(driver, (KC_F5));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_f5);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_TRUE(combo_events.empty());
+}
+
+TEST_F(ComboIndex, per_event_cost) {
+    measure_per_event_cost(*this, "indexed");
+}
@@ -0,0 +1,11 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// Keymap introspection requires key_combos to exist; the combos actually used
+// by the tests are served by combo_count()/combo_get() in generated_combos.c.
+uint16_t const placeholder_combo[] = {KC_A, KC_B, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO_ACTION(placeholder_combo),
+};
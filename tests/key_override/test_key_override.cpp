@@ -0,0 +1,278 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" bool alt_layer2_override_enabled;
+
+class KeyOverride : public TestFixture {};
+
+TEST_F(KeyOverride, ShiftBackspaceSendsDelete) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, TriggerWithoutModsIsNotOverridden) {
+    TestDriver driver;
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_bspc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModPressedAfterTriggerActivatesAfterDelay) {
+    TestDriver driver;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_bspc(0, 1, 0, KC_BSPC);
+    set_keymap({key_shift, key_bspc});
+
+    EXPECT_REPORT(driver, (KC_BSPC));
+    key_bspc.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The trigger is removed straight away, the replacement follows once the key repeat delay has passed
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_DEL));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_bspc.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, EarlierOverrideOnMatchingLayerWins) {
+    TestDriver driver;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_a(0, 1, 0, KC_A);
+    KeymapKey  key_mo(0, 2, 0, MO(1));
+    KeymapKey  key_ctrl_l1(1, 0, 0, KC_LCTL);
+    KeymapKey  key_a_l1(1, 1, 0, KC_A);
+    set_keymap({key_ctrl, key_a, key_mo, key_ctrl_l1, key_a_l1});
+
+    // Layer 0: the layer 1 override is skipped
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Layer 1: both overrides match, the first one wins
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_ctrl_l1.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(key_a_l1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl_l1.release();
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, SameTriggerUsesFirstOverride) {
+    TestDriver driver;
+    KeymapKey  key_gui(0, 0, 0, KC_LGUI);
+    KeymapKey  key_x(0, 1, 0, KC_X);
+    set_keymap({key_gui, key_x});
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    key_gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F15));
+    EXPECT_REPORT(driver, (KC_LGUI));
+    tap_key(key_x);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, NegativeModBlocksOverride) {
+    TestDriver driver;
+    KeymapKey  key_ctrl(0, 0, 0, KC_LCTL);
+    KeymapKey  key_shift(0, 1, 0, KC_LSFT);
+    KeymapKey  key_1(0, 2, 0, KC_1);
+    set_keymap({key_ctrl, key_shift, key_1});
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    key_ctrl.press();
+    run_one_scan_loop();
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT, KC_1));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_LSFT));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LCTL));
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F1));
+    EXPECT_REPORT(driver, (KC_LCTL));
+    tap_key(key_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ctrl.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModOnlyOverrideThenTriggeredOverride) {
+    TestDriver driver;
+    KeymapKey  key_ralt(0, 0, 0, KC_RALT);
+    KeymapKey  key_z(0, 1, 0, KC_Z);
+    set_keymap({key_ralt, key_z});
+
+    // The mod-only override comes first in the list and activates on the modifier alone, suppressing it
+    EXPECT_NO_REPORT(driver);
+    key_ralt.press();
+    run_one_scan_loop();
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    // Pressing the trigger of the later override replaces it before the deferred replacement is sent
+    {
+        InSequence s;
+        EXPECT_REPORT(driver, (KC_RALT));
+        EXPECT_REPORT(driver, (KC_F14));
+        EXPECT_REPORT(driver, (KC_RALT));
+    }
+    tap_key(key_z);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_ralt.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, ModOnlyOverrideOnLayer) {
+    TestDriver driver;
+    KeymapKey  key_lalt(0, 0, 0, KC_LALT);
+    KeymapKey  key_mo(0, 1, 0, MO(2));
+    KeymapKey  key_lalt_l2(2, 0, 0, KC_LALT);
+    set_keymap({key_lalt, key_mo, key_lalt_l2});
+
+    // Only applies to layer 2
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_lalt);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    key_mo.press();
+    run_one_scan_loop();
+    key_lalt_l2.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_F17));
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    // Deactivating the override restores the suppressed modifier before it is released
+    EXPECT_REPORT(driver, (KC_LALT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lalt_l2.release();
+    run_one_scan_loop();
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyOverride, DisabledOverrideIsSkipped) {
+    TestDriver driver;
+    KeymapKey  key_mo(0, 1, 0, MO(2));
+    KeymapKey  key_lalt_l2(2, 0, 0, KC_LALT);
+    set_keymap({key_mo, key_lalt_l2});
+
+    alt_layer2_override_enabled = false;
+
+    EXPECT_REPORT(driver, (KC_LALT));
+    key_mo.press();
+    run_one_scan_loop();
+    key_lalt_l2.press();
+    run_one_scan_loop();
+    idle_for(500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_lalt_l2.release();
+    run_one_scan_loop();
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    alt_layer2_override_enabled = true;
+}
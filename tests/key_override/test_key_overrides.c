@@ -0,0 +1,41 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+bool alt_layer2_override_enabled = true;
+
+// Order matters: overrides are tried in order, so earlier ones win when several match.
+const key_override_t shift_bspc_override  = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t ctrl_a_layer1        = ko_make_with_layers(MOD_MASK_CTRL, KC_A, KC_B, 1 << 1);
+const key_override_t ctrl_a_override      = ko_make_basic(MOD_MASK_CTRL, KC_A, KC_C);
+const key_override_t ctrl_1_negshift      = ko_make_with_layers_and_negmods(MOD_MASK_CTRL, KC_1, KC_F1, ~0, MOD_MASK_SHIFT);
+const key_override_t ralt_no_trigger      = ko_make_basic(MOD_BIT(KC_RALT), KC_NO, KC_F13);
+const key_override_t ralt_z_override      = ko_make_basic(MOD_BIT(KC_RALT), KC_Z, KC_F14);
+const key_override_t gui_x_override       = ko_make_basic(MOD_MASK_GUI, KC_X, KC_F15);
+const key_override_t gui_x_override_later = ko_make_basic(MOD_MASK_GUI, KC_X, KC_F16);
+const key_override_t alt_layer2_override  = {
+     .trigger_mods      = MOD_MASK_ALT,
+     .layers            = 1 << 2,
+     .suppressed_mods   = MOD_MASK_ALT,
+     .options           = ko_options_default,
+     .negative_mod_mask = 0,
+     .custom_action     = NULL,
+     .context           = NULL,
+     .trigger           = KC_NO,
+     .replacement       = KC_F17,
+     .enabled           = &alt_layer2_override_enabled,
+};
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &shift_bspc_override,
+    &ctrl_a_layer1,
+    &ctrl_a_override,
+    &ctrl_1_negshift,
+    &ralt_no_trigger,
+    &ralt_z_override,
+    &gui_x_override,
+    &gui_x_override_later,
+    &alt_layer2_override,
+};
+// clang-format on
@@ -0,0 +1,52 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Runs the key override suite with the trigger index enabled, the behaviour must be identical.
+#include "../test_key_override.cpp"
+
+extern "C" uint16_t key_override_get_calls;
+
+TEST_F(KeyOverride, OnlyCandidateOverridesAreFetched) {
+    TestDriver driver;
+    KeymapKey  key_gui(0, 0, 0, KC_LGUI);
+    KeymapKey  key_x(0, 1, 0, KC_X);
+    KeymapKey  key_y(0, 2, 0, KC_Y);
+    set_keymap({key_gui, key_x, key_y});
+
+    // Builds the index
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_y);
+    VERIFY_AND_CLEAR(driver);
+
+    // No override uses KC_Y, and the mod-only overrides need mods or are on another layer
+    key_override_get_calls = 0;
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_y);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_override_get_calls, 0);
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    key_gui.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The right alt mod-only override comes first, then only the first of the two KC_X overrides needs to be checked
+    key_override_get_calls = 0;
+    EXPECT_REPORT(driver, (KC_F15));
+    key_x.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_override_get_calls, 2);
+
+    EXPECT_REPORT(driver, (KC_LGUI));
+    key_x.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_gui.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,232 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+extern "C" {
+#include "latency_trace.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTrace : public TestFixture {
+   public:
+    void SetUp() override {
+        latency_trace_reset();
+    }
+
+    // The test platform has a millisecond timer, so every latency is a whole number of milliseconds
+    static const latency_trace_stats_t &stats(latency_trace_stage_t stage) {
+        return *latency_trace_get_stats(stage);
+    }
+};
+
+TEST_F(LatencyTrace, PlainKeyIsReportedInTheSameScan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).count, 2);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).max, 0);
+    EXPECT_EQ(stats(LATENCY_TRACE_PROCESS).count, 2);
+    EXPECT_EQ(stats(LATENCY_TRACE_TAPPING).count, 2);
+    EXPECT_EQ(stats(LATENCY_TRACE_COMBO).count, 2);
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).count, 0);
+}
+
+TEST_F(LatencyTrace, TapHoldDelayIsAttributedToTapping) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(50);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The press waits in the tapping state until the release resolves it as a tap
+    EXPECT_EQ(stats(LATENCY_TRACE_TAPPING).max, 50000);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).max, 50000);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).min, 0);
+    EXPECT_EQ(stats(LATENCY_TRACE_COMBO).max, 0);
+}
+
+TEST_F(LatencyTrace, ComboWaitIsAttributedToCombo) {
+    TestDriver driver;
+    auto       key_j = KeymapKey(0, 0, 0, KC_J);
+    auto       key_k = KeymapKey(0, 1, 0, KC_K);
+    set_keymap({key_j, key_k});
+
+    // A lone combo key is held back until it can no longer be part of a combo
+    EXPECT_NO_REPORT(driver);
+    key_j.press();
+    idle_for(30);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_J));
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACE_COMBO).max, 30000);
+    EXPECT_EQ(stats(LATENCY_TRACE_TAPPING).max, 0);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).max, 30000);
+}
+
+TEST_F(LatencyTrace, EventsWithoutReportAreDropped) {
+    TestDriver driver;
+    auto       layer_key = KeymapKey(0, 0, 0, MO(1));
+    auto       key       = KeymapKey(1, 1, 0, KC_B);
+    set_keymap({layer_key, key, KeymapKey(0, 1, 0, KC_A)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The layer key press was processed but never reported, it must not be counted with the next report
+    EXPECT_EQ(stats(LATENCY_TRACE_TAPPING).count, 2);
+    EXPECT_EQ(stats(LATENCY_TRACE_PROCESS).count, 1);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).count, 1);
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, DebounceStartsAtFirstRawChange) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    // The test matrix has no debounce, so pretend the raw matrix changed earlier
+    latency_trace_raw_change();
+    idle_for(3);
+    latency_trace_raw_change();
+    idle_for(2);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).count, 1);
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).max, 5000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).count, 1);
+}
+
+TEST_F(LatencyTrace, BounceWithoutEdgeIsNotTimed) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    // A bounce that the debouncer filtered out, followed much later by a real press
+    latency_trace_raw_change();
+    idle_for(3);
+    latency_trace_raw_settled();
+    idle_for(50);
+    latency_trace_raw_change();
+    idle_for(2);
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).count, 1);
+    EXPECT_EQ(stats(LATENCY_TRACE_DEBOUNCE).max, 2000);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyTrace, PercentileFollowsHistogram) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+    for (int i = 0; i < 9; i++) {
+        tap_key(mod_tap_key);
+        // Let the tapping term pass, so that the next press does not continue the tap sequence
+        idle_for(TAPPING_TERM);
+    }
+    mod_tap_key.press();
+    idle_for(100);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Releases pass straight through, nine presses resolve after 1ms and the last one after 100ms
+    EXPECT_EQ(latency_trace_percentile(LATENCY_TRACE_TAPPING, 50), 0);
+    EXPECT_EQ(latency_trace_percentile(LATENCY_TRACE_TAPPING, 90), 1023);
+    EXPECT_EQ(latency_trace_percentile(LATENCY_TRACE_TAPPING, 100), 100000);
+}
+
+TEST_F(LatencyTrace, RawHidCommands) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    uint8_t data[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_GET_INFO};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[2], LATENCY_TRACE_STAGE_COUNT);
+    EXPECT_EQ(data[3], LATENCY_TRACE_HISTOGRAM_BUCKETS);
+    EXPECT_EQ(data[4] | data[5] << 8, 1000);
+
+    uint8_t stage[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_GET_STAGE, LATENCY_TRACE_TOTAL};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(stage, sizeof(stage)));
+    EXPECT_EQ(stage[2], LATENCY_TRACE_TOTAL);
+    EXPECT_EQ(stage[3], 2);
+
+    uint8_t histogram[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_GET_HISTOGRAM, LATENCY_TRACE_TOTAL, 0};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(histogram, sizeof(histogram)));
+    EXPECT_EQ(histogram[4] | histogram[5] << 8, 2);
+
+    uint8_t invalid[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_GET_STAGE, LATENCY_TRACE_STAGE_COUNT};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(invalid, sizeof(invalid)));
+    EXPECT_EQ(invalid[1], 0xFF);
+
+    uint8_t other[32] = {0x01};
+    EXPECT_FALSE(latency_trace_raw_hid_receive(other, sizeof(other)));
+
+    uint8_t reset[32] = {LATENCY_TRACE_RAW_HID_ID, LATENCY_TRACE_RESET};
+    EXPECT_TRUE(latency_trace_raw_hid_receive(reset, sizeof(reset)));
+    EXPECT_EQ(stats(LATENCY_TRACE_TOTAL).count, 0);
+}
@@ -0,0 +1,74 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "gtest/gtest.h"
+#include "../qp_surface_test_panel.hpp"
+
+TEST_P(QuantumPainterSurface, nothing_dirty_sends_nothing) {
+    ASSERT_TRUE(draw());
+    EXPECT_EQ(bytes_sent, 0);
+}
+
+TEST_P(QuantumPainterSurface, corner_pixels_send_two_tiles) {
+    qp_setpixel(surface, 0, 0, 0, 0, 255);
+    qp_setpixel(surface, panel_width - 1, panel_height - 1, 0, 0, 255);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+    report("corner pixels", bounding_box);
+
+    EXPECT_EQ(viewports_set, 2);
+    EXPECT_LE(bytes_sent, 2 * (viewport_bytes + (SURFACE_DIRTY_TILE_SIZE * SURFACE_DIRTY_TILE_SIZE * bpp() + 7) / 8));
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, clock_and_layer_indicator) {
+    // Clock digits in the top left, layer indicator in the bottom right
+    qp_rect(surface, 8, 4, 47, 19, 0, 0, 255, true);
+    qp_rect(surface, 216, 296, 231, 311, 0, 0, 255, true);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+    report("clock + layer indicator", bounding_box);
+
+    EXPECT_LT(bytes_sent * 10, bounding_box);
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, status_bar) {
+    qp_rect(surface, 0, 0, panel_width - 1, 11, 0, 0, 255, true);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+    report("status bar", bounding_box);
+
+    // The bar fits the bounding box, only splitting it in runs costs a little extra
+    EXPECT_LE(bytes_sent, bounding_box + viewport_bytes);
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, full_redraw) {
+    qp_rect(surface, 0, 0, panel_width - 1, panel_height - 1, 0, 0, 255, true);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+    report("full redraw", bounding_box);
+
+    uint32_t tile_rows = (panel_height + SURFACE_DIRTY_TILE_SIZE - 1) / SURFACE_DIRTY_TILE_SIZE;
+    EXPECT_EQ(bytes_sent, bounding_box + (tile_rows - 1) * viewport_bytes);
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, random_shapes_stay_in_sync) {
+    std::mt19937 rng(1);
+    for (int i = 0; i < 50; ++i) {
+        uint16_t l = rng() % panel_width;
+        uint16_t t = rng() % panel_height;
+        uint16_t r = std::min<uint16_t>(panel_width - 1, l + rng() % 40);
+        uint16_t b = std::min<uint16_t>(panel_height - 1, t + rng() % 40);
+        qp_rect(surface, l, t, r, b, rng() % 256, 255, rng() % 256, rng() % 2);
+        if (i % 5 == 4) {
+            ASSERT_TRUE(draw());
+            expect_panel_in_sync();
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, QuantumPainterSurface, testing::Values(16, 1), [](const testing::TestParamInfo<uint8_t> &info) { return info.param == 16 ? "rgb565" : "mono1bpp"; });
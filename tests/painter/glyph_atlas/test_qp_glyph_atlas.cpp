@@ -0,0 +1,135 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+#include "../qff_test_font.hpp"
+#include "../status_strings_benchmark.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+}
+
+static constexpr uint16_t surface_width  = 320;
+static constexpr uint8_t  line_height    = 16;
+static constexpr uint32_t first_glyph    = 0x4E00;
+static constexpr uint16_t num_glyphs     = 128;
+static constexpr uint16_t white          = 0xFFFF;
+static constexpr uint16_t red            = 0x00F8; // surfaces hold rgb565 big-endian, as sent to the panel
+static constexpr uint16_t black          = 0x0000;
+static constexpr uint8_t  base_width     = 6;
+static constexpr uint8_t  width_variants = 4;
+
+static uint8_t glyph_width(uint32_t code_point) {
+    return base_width + (code_point % width_variants);
+}
+
+static std::vector<QFFTestFont::Glyph> make_glyphs(uint8_t extra_width = 0) {
+    std::vector<QFFTestFont::Glyph> glyphs;
+    for (uint32_t code_point = first_glyph; code_point < first_glyph + num_glyphs; ++code_point) {
+        glyphs.push_back({code_point, (uint8_t)(glyph_width(code_point) + extra_width)});
+    }
+    return glyphs;
+}
+
+class QuantumPainterGlyphAtlas : public testing::Test {
+   protected:
+    void SetUp() override {
+        memset(framebuffer, 0, sizeof(framebuffer));
+        surface = qp_make_rgb565_surface_advanced(surfaces, 1, surface_width, line_height, framebuffer);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        font_data = new QFFTestFont(line_height, make_glyphs());
+        font      = qp_load_font_mem(font_data->buffer());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+        delete font_data;
+    }
+
+    // Consecutive glyphs of the font, starting at the given index
+    static std::string make_string(unsigned first, unsigned length, int16_t *expected_width) {
+        std::string str;
+        *expected_width = 0;
+        for (unsigned i = 0; i < length; ++i) {
+            uint32_t code_point = first_glyph + (first + i) % num_glyphs;
+            str += QFFTestFont::utf8(code_point);
+            *expected_width += glyph_width(code_point);
+        }
+        return str;
+    }
+
+    void expect_row(uint16_t from, uint16_t to, uint16_t value) {
+        for (uint16_t y = 0; y < line_height; ++y) {
+            for (uint16_t x = from; x < to; ++x) {
+                ASSERT_EQ(framebuffer[y * surface_width + x], value) << "at " << x << "," << y;
+            }
+        }
+    }
+
+    uint16_t                 framebuffer[surface_width * line_height];
+    surface_painter_device_t surfaces[1] = {};
+    painter_device_t         surface;
+    QFFTestFont             *font_data;
+    painter_font_handle_t    font;
+};
+
+TEST_F(QuantumPainterGlyphAtlas, redrawn_text_matches_first_draw) {
+    int16_t     expected_width;
+    std::string str = make_string(0, 20, &expected_width);
+
+    ASSERT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), expected_width);
+    std::vector<uint16_t> first(framebuffer, framebuffer + surface_width * line_height);
+
+    memset(framebuffer, 0, sizeof(framebuffer));
+    ASSERT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), expected_width);
+    EXPECT_EQ(std::vector<uint16_t>(framebuffer, framebuffer + surface_width * line_height), first);
+    expect_row(0, expected_width, white);
+    expect_row(expected_width, surface_width, black);
+}
+
+TEST_F(QuantumPainterGlyphAtlas, colors_are_part_of_the_key) {
+    int16_t     expected_width;
+    std::string str = make_string(0, 4, &expected_width);
+
+    ASSERT_EQ(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, 0, 255, 0, 0, 0), expected_width);
+    expect_row(0, expected_width, white);
+    ASSERT_EQ(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, 255, 255, 0, 0, 0), expected_width);
+    expect_row(0, expected_width, red);
+    ASSERT_EQ(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, 0, 255, 0, 0, 0), expected_width);
+    expect_row(0, expected_width, white);
+}
+
+TEST_F(QuantumPainterGlyphAtlas, evicted_glyphs_are_decoded_again) {
+    // Many more glyphs than fit in the atlas, drawn in alternating colors
+    for (unsigned i = 0; i < num_glyphs; i += 8) {
+        int16_t     expected_width;
+        std::string str = make_string(i, 24, &expected_width);
+        uint8_t     sat = (i / 8) % 2 ? 255 : 0;
+
+        ASSERT_EQ(qp_drawtext_recolor(surface, 0, 0, font, str.c_str(), 0, sat, 255, 0, 0, 0), expected_width);
+        expect_row(0, expected_width, sat ? red : white);
+    }
+}
+
+TEST_F(QuantumPainterGlyphAtlas, closing_a_font_forgets_its_glyphs) {
+    int16_t     expected_width;
+    std::string str = make_string(0, 1, &expected_width);
+    ASSERT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), expected_width);
+
+    // The next font loaded reuses the slot, with wider glyphs for the same code points
+    qp_close_font(font);
+    QFFTestFont wider(line_height, make_glyphs(3));
+    font = qp_load_font_mem(wider.buffer());
+    ASSERT_NE(font, nullptr);
+    EXPECT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), expected_width + 3);
+}
+
+// Status widgets redrawing the same strings from the atlas, the decoded baseline is measured by the painter suite, built without it
+TEST_F(QuantumPainterGlyphAtlas, status_strings_benchmark) {
+    printf("[ PAINTER  ] %u glyph status strings: %llu ns per string from the glyph atlas\n", StatusStringsBenchmark::length, (unsigned long long)StatusStringsBenchmark::run());
+}
@@ -0,0 +1,158 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "gtest/gtest.h"
+#include "test_env.hpp"
+#include "../qff_test_font.hpp"
+#include "../qgf_test_image.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_host.h"
+}
+
+static constexpr uint16_t canvas_width  = 64;
+static constexpr uint16_t canvas_height = 48;
+
+// Golden images live next to this file; set QP_GOLDEN_UPDATE to rewrite them from the current rendering. A mismatching
+// rendering is written alongside its golden image, with an .actual.ppm suffix.
+static std::string golden_path(const std::string &name) {
+    std::string file = __FILE__;
+    return file.substr(0, file.find_last_of('/')) + "/golden/" + name + ".ppm";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scenes, each drawn onto a cleared canvas
+
+struct Assets {
+    QFFTestFont            font_data{12, {{0x4E00, 3}, {0x4E01, 4}, {0x4E02, 5}, {0x4E03, 6}}, 0x6C};
+    QGFTestImage           raw_data{48, 32};
+    QGFTestImage           rle_data{48, 32, IMAGE_COMPRESSED_RLE};
+    painter_font_handle_t  font;
+    painter_image_handle_t raw;
+    painter_image_handle_t rle;
+};
+
+struct Scene {
+    const char *name;
+    const char *golden;
+    bool (*draw)(painter_device_t device, const Assets &assets);
+};
+
+static bool draw_rects(painter_device_t device, const Assets &assets) {
+    // Filled red and blue, outlined green and white
+    return qp_rect(device, 2, 2, 29, 21, 0, 255, 255, true) && qp_rect(device, 34, 2, 61, 21, 85, 255, 255, false) && qp_rect(device, 8, 26, 55, 45, 170, 255, 255, true) && qp_rect(device, 20, 30, 43, 41, 0, 0, 255, false);
+}
+
+static bool draw_circles(painter_device_t device, const Assets &assets) {
+    // Filled yellow, outlined cyan and magenta
+    return qp_circle(device, 16, 16, 12, 43, 255, 255, true) && qp_circle(device, 46, 16, 12, 128, 255, 255, false) && qp_circle(device, 32, 34, 10, 213, 255, 255, false);
+}
+
+static bool draw_ellipses(painter_device_t device, const Assets &assets) {
+    // Outlined red, filled blue with a filled dark green one inside
+    return qp_ellipse(device, 32, 12, 28, 8, 0, 255, 255, false) && qp_ellipse(device, 32, 34, 16, 12, 170, 255, 255, true) && qp_ellipse(device, 32, 34, 6, 10, 85, 255, 160, true);
+}
+
+static bool draw_lines(painter_device_t device, const Assets &assets) {
+    // A fan from the bottom left corner, then a horizontal and a vertical line
+    for (uint16_t i = 0; i < 8; ++i) {
+        if (!qp_line(device, 0, canvas_height - 1, i * 9, 0, i * 32, 255, 255)) {
+            return false;
+        }
+    }
+    return qp_line(device, 0, 24, canvas_width - 1, 24, 0, 0, 255) && qp_line(device, 40, 0, 40, canvas_height - 1, 0, 0, 128);
+}
+
+static bool draw_raw_image(painter_device_t device, const Assets &assets) {
+    return qp_drawimage(device, 8, 8, assets.raw);
+}
+
+static bool draw_rle_image(painter_device_t device, const Assets &assets) {
+    return qp_drawimage(device, 8, 8, assets.rle);
+}
+
+static bool draw_text(painter_device_t device, const Assets &assets) {
+    // White on black, then red on dark blue
+    return qp_drawtext(device, 2, 4, assets.font, "\xe4\xb8\x80\xe4\xb8\x81\xe4\xb8\x82\xe4\xb8\x83") > 0 && qp_drawtext_recolor(device, 10, 24, assets.font, "\xe4\xb8\x83\xe4\xb8\x82\xe4\xb8\x81", 0, 255, 255, 170, 255, 96) > 0;
+}
+
+// Both images decode to the same pixels, so they share a golden image
+static const Scene scenes[] = {
+    {"rect", "rect", draw_rects},
+    {"circle", "circle", draw_circles},
+    {"ellipse", "ellipse", draw_ellipses},
+    {"line", "line", draw_lines},
+    {"image_raw", "image", draw_raw_image},
+    {"image_rle", "image", draw_rle_image},
+    {"text", "text", draw_text},
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class QuantumPainterHost : public testing::TestWithParam<Scene> {
+   protected:
+    void SetUp() override {
+        device = qp_host_make_device(canvas_width, canvas_height);
+        ASSERT_NE(device, nullptr);
+        ASSERT_TRUE(qp_init(device, QP_ROTATION_0));
+
+        assets.font = qp_load_font_mem(assets.font_data.buffer());
+        assets.raw  = qp_load_image_mem(assets.raw_data.buffer());
+        assets.rle  = qp_load_image_mem(assets.rle_data.buffer());
+        ASSERT_NE(assets.font, nullptr);
+        ASSERT_NE(assets.raw, nullptr);
+        ASSERT_NE(assets.rle, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_image(assets.rle);
+        qp_close_image(assets.raw);
+        qp_close_font(assets.font);
+        qp_host_free_device(device);
+    }
+
+    painter_device_t device;
+    Assets           assets;
+};
+
+TEST_P(QuantumPainterHost, matches_golden_image) {
+    const Scene &scene = GetParam();
+    ASSERT_TRUE(scene.draw(device, assets));
+
+    std::string golden = golden_path(scene.golden);
+    if (std::getenv("QP_GOLDEN_UPDATE")) {
+        ASSERT_TRUE(qp_host_save_ppm(device, golden.c_str())) << "could not write " << golden;
+        return;
+    }
+
+    int32_t differences = qp_host_compare_ppm(device, golden.c_str());
+    if (differences != 0) {
+        std::string actual = golden.substr(0, golden.size() - 4) + ".actual.ppm";
+        qp_host_save_ppm(device, actual.c_str());
+        FAIL() << differences << " pixels differ from " << golden << " (-1 if unreadable), rendered to " << actual;
+    }
+}
+
+// Iterations can be set through QP_HOST_BENCH_ITERATIONS
+TEST_P(QuantumPainterHost, benchmark) {
+    const Scene &scene      = GetParam();
+    unsigned     iterations = env_or("QP_HOST_BENCH_ITERATIONS", 500);
+
+    uint64_t start_pixels = qp_host_pixels_written(device);
+    auto     start        = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        ASSERT_TRUE(scene.draw(device, assets));
+    }
+    uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    uint64_t pixels  = qp_host_pixels_written(device) - start_pixels;
+
+    printf("[ PAINTER  ] %-10s %8.2f Mpixels/s, %7.0f ns per draw\n", scene.name, pixels * 1e3 / elapsed, (double)elapsed / iterations);
+    EXPECT_GT(pixels, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(Scenes, QuantumPainterHost, testing::ValuesIn(scenes), [](const testing::TestParamInfo<Scene> &info) { return std::string(info.param.name); });
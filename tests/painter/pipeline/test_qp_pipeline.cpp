@@ -0,0 +1,275 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_env.hpp"
+#include "../qff_test_font.hpp"
+#include "../qgf_test_image.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+}
+
+using steady_clock = std::chrono::steady_clock;
+
+static constexpr uint16_t panel_width  = 240;
+static constexpr uint16_t panel_height = 240;
+
+// Bytes a typical SPI panel sends to set its viewport
+static constexpr uint32_t viewport_bytes = 3 + 2 * 4;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Simulated-latency comms: every byte keeps the bus busy for a while, in real time. Blocking sends spin until their
+// transfer is done, non-blocking ones only mark the bus busy and return, like a DMA transfer would.
+
+struct latency_bus_t {
+    uint64_t                 ns_per_byte;
+    steady_clock::time_point busy_until;
+    steady_clock::time_point started;
+
+    // Transfer in flight, its data is only captured once it completes, as a DMA transfer would read it as it goes
+    const uint8_t *in_flight;
+    uint32_t       in_flight_bytes;
+
+    std::vector<uint8_t> received;
+    uint32_t             async_transfers;
+    uint64_t             busy_ns;
+    uint64_t             overlapped_ns; // bus time spent while the CPU was doing something else
+};
+
+static latency_bus_t bus;
+
+static void spin_until(steady_clock::time_point until) {
+    while (steady_clock::now() < until) {
+    }
+}
+
+static bool latency_comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool latency_comms_start(painter_device_t device) {
+    return true;
+}
+
+static void latency_comms_stop(painter_device_t device) {}
+
+static void latency_comms_wait(painter_device_t device) {
+    if (!bus.in_flight) {
+        return;
+    }
+
+    auto now = steady_clock::now();
+    bus.overlapped_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(std::min(now, bus.busy_until) - bus.started).count();
+    spin_until(bus.busy_until);
+
+    bus.received.insert(bus.received.end(), bus.in_flight, bus.in_flight + bus.in_flight_bytes);
+    bus.in_flight = nullptr;
+}
+
+static uint32_t latency_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    latency_comms_wait(device);
+
+    bus.started         = steady_clock::now();
+    bus.busy_until      = bus.started + std::chrono::nanoseconds(byte_count * bus.ns_per_byte);
+    bus.in_flight       = (const uint8_t *)data;
+    bus.in_flight_bytes = byte_count;
+    bus.busy_ns += byte_count * bus.ns_per_byte;
+    bus.async_transfers++;
+    return byte_count;
+}
+
+static uint32_t latency_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    latency_comms_wait(device);
+
+    spin_until(steady_clock::now() + std::chrono::nanoseconds(byte_count * bus.ns_per_byte));
+    bus.received.insert(bus.received.end(), (const uint8_t *)data, (const uint8_t *)data + byte_count);
+    bus.busy_ns += byte_count * bus.ns_per_byte;
+    return byte_count;
+}
+
+static const painter_comms_vtable_t latency_comms_vtable = {
+    .comms_init  = latency_comms_init,
+    .comms_start = latency_comms_start,
+    .comms_stop  = latency_comms_stop,
+    .comms_send  = latency_comms_send,
+};
+
+static const painter_comms_vtable_t latency_pipelined_comms_vtable = {
+    .comms_init       = latency_comms_init,
+    .comms_start      = latency_comms_start,
+    .comms_stop       = latency_comms_stop,
+    .comms_send       = latency_comms_send,
+    .comms_send_async = latency_comms_send_async,
+    .comms_wait       = latency_comms_wait,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RGB565 panel, sending like the TFT panels do
+
+static bool test_panel_noop(painter_device_t device) {
+    return true;
+}
+
+static bool test_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool test_panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool test_panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t commands[viewport_bytes] = {0x2A, (uint8_t)(left >> 8), (uint8_t)left, (uint8_t)(right >> 8), (uint8_t)right, 0x2B, (uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(bottom >> 8), (uint8_t)bottom, 0x2C};
+    qp_comms_send(device, commands, sizeof(commands));
+    return true;
+}
+
+static bool test_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send_async(device, pixel_data, native_pixel_count * 2);
+    return true;
+}
+
+static bool test_panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        uint8_t v         = palette[i].hsv888.v;
+        palette[i].rgb565 = ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+    }
+    return true;
+}
+
+static bool test_panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    uint16_t *buf = (uint16_t *)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool test_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+static const painter_driver_vtable_t test_panel_vtable = {
+    .init            = test_panel_init,
+    .power           = test_panel_power,
+    .clear           = test_panel_noop,
+    .flush           = test_panel_noop,
+    .viewport        = test_panel_viewport,
+    .pixdata         = test_panel_pixdata,
+    .palette_convert = test_panel_palette_convert,
+    .append_pixels   = test_panel_append_pixels,
+    .append_pixdata  = test_panel_append_pixdata,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct draw_result_t {
+    std::vector<uint8_t> received;
+    uint64_t             elapsed_ns;
+    uint64_t             busy_ns;
+    uint64_t             overlapped_ns;
+    uint32_t             async_transfers;
+};
+
+class QuantumPainterPipeline : public testing::Test {
+   protected:
+    void SetUp() override {
+        panel                       = painter_driver_t{};
+        panel.driver_vtable         = &test_panel_vtable;
+        panel.native_bits_per_pixel = 16;
+        panel.panel_width           = panel_width;
+        panel.panel_height          = panel_height;
+        bus.ns_per_byte             = env_or("QP_PIPELINE_NS_PER_BYTE", 4);
+        font_data                   = new QFFTestFont(20, make_glyphs());
+        font                        = qp_load_font_mem(font_data->buffer());
+        image_data                  = new QGFTestImage(panel_width, panel_height);
+        image                       = qp_load_image_mem(image_data->buffer());
+        ASSERT_NE(font, nullptr);
+        ASSERT_NE(image, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_image(image);
+        qp_close_font(font);
+        delete image_data;
+        delete font_data;
+    }
+
+    static std::vector<QFFTestFont::Glyph> make_glyphs() {
+        std::vector<QFFTestFont::Glyph> glyphs;
+        for (uint32_t code_point = 0x4E00; code_point < 0x4E00 + 16; ++code_point) {
+            glyphs.push_back({code_point, (uint8_t)(10 + code_point % 4)});
+        }
+        return glyphs;
+    }
+
+    template <typename Draw>
+    draw_result_t measure(const painter_comms_vtable_t *comms, unsigned iterations, Draw draw) {
+        panel.comms_vtable = comms;
+        EXPECT_TRUE(qp_init((painter_device_t)&panel, QP_ROTATION_0));
+        bus = latency_bus_t{.ns_per_byte = bus.ns_per_byte};
+
+        auto start = steady_clock::now();
+        for (unsigned i = 0; i < iterations; ++i) {
+            EXPECT_TRUE(draw());
+        }
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(steady_clock::now() - start).count();
+
+        EXPECT_EQ(bus.in_flight, nullptr) << "transfer still in flight after drawing";
+        return {bus.received, elapsed, bus.busy_ns, bus.overlapped_ns, bus.async_transfers};
+    }
+
+    void report(const char *what, const draw_result_t &blocking, const draw_result_t &pipelined) {
+        printf("[ PAINTER  ] %-10s %7.0f KB/s blocking, %7.0f KB/s pipelined (%.2fx), %3.0f%% of bus time overlapped\n", what, blocking.received.size() * 1e6 / blocking.elapsed_ns, pipelined.received.size() * 1e6 / pipelined.elapsed_ns, (double)blocking.elapsed_ns / pipelined.elapsed_ns, 100.0 * pipelined.overlapped_ns / pipelined.busy_ns);
+    }
+
+    painter_driver_t       panel;
+    QFFTestFont           *font_data;
+    painter_font_handle_t  font;
+    QGFTestImage          *image_data;
+    painter_image_handle_t image;
+};
+
+TEST_F(QuantumPainterPipeline, blocking_comms_never_overlap) {
+    auto result = measure(&latency_comms_vtable, 1, [&] { return qp_drawimage((painter_device_t)&panel, 0, 0, image); });
+
+    EXPECT_EQ(result.async_transfers, 0);
+    EXPECT_EQ(result.overlapped_ns, 0);
+    EXPECT_EQ(result.received.size(), viewport_bytes + panel_width * panel_height * 2);
+}
+
+// Bus speed and the number of draws measured can be set through QP_PIPELINE_NS_PER_BYTE and QP_PIPELINE_ITERATIONS
+TEST_F(QuantumPainterPipeline, drawimage_overlaps_decode_and_transfer) {
+    unsigned iterations = env_or("QP_PIPELINE_ITERATIONS", 5);
+    auto     blocking   = measure(&latency_comms_vtable, iterations, [&] { return qp_drawimage((painter_device_t)&panel, 0, 0, image); });
+    auto     pipelined  = measure(&latency_pipelined_comms_vtable, iterations, [&] { return qp_drawimage((painter_device_t)&panel, 0, 0, image); });
+    report("drawimage", blocking, pipelined);
+
+    // Same bytes on the wire, each pixdata buffer left alone while it was in flight
+    EXPECT_EQ(pipelined.received, blocking.received);
+    EXPECT_GT(pipelined.async_transfers, 0);
+    EXPECT_GT(pipelined.overlapped_ns, 0);
+}
+
+TEST_F(QuantumPainterPipeline, drawtext_overlaps_decode_and_transfer) {
+    std::string str;
+    for (uint32_t i = 0; i < 20; ++i) {
+        str += QFFTestFont::utf8(0x4E00 + i * 7 % 16);
+    }
+
+    unsigned iterations = env_or("QP_PIPELINE_ITERATIONS", 5) * 20;
+    auto     draw       = [&] { return qp_drawtext((painter_device_t)&panel, 0, 0, font, str.c_str()) > 0; };
+    auto     blocking   = measure(&latency_comms_vtable, iterations, draw);
+    auto     pipelined  = measure(&latency_pipelined_comms_vtable, iterations, draw);
+    report("drawtext", blocking, pipelined);
+
+    EXPECT_EQ(pipelined.received, blocking.received);
+    EXPECT_GT(pipelined.async_transfers, 0);
+    EXPECT_GT(pipelined.overlapped_ns, 0);
+}
@@ -0,0 +1,102 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "qff.h"
+}
+
+// Builds an uncompressed 1bpp grayscale QFF font in memory, containing only a unicode glyph table.
+class QFFTestFont {
+   public:
+    struct Glyph {
+        uint32_t code_point;
+        uint8_t  width;
+    };
+
+    QFFTestFont(uint8_t line_height, const std::vector<Glyph>& glyphs, uint8_t fill = 0xFF) {
+        // Glyph pixel data is shared between glyphs of the same width; each glyph is a rectangle filled with the given
+        // bit pattern, solid by default
+        std::vector<uint8_t>  data;
+        std::vector<uint32_t> width_offsets(QFF_GLYPH_WIDTH_MASK + 1, UINT32_MAX);
+        for (const Glyph& g : glyphs) {
+            if (width_offsets[g.width] == UINT32_MAX) {
+                width_offsets[g.width] = data.size();
+                data.insert(data.end(), (g.width * line_height + 7) / 8, fill);
+            }
+        }
+
+        uint32_t num_glyphs  = glyphs.size();
+        uint32_t unicode_len = num_glyphs * sizeof(qff_unicode_glyph_v1_t);
+        uint32_t total_size  = sizeof(qff_font_descriptor_v1_t) + sizeof(qgf_block_header_v1_t) + unicode_len + sizeof(qgf_block_header_v1_t) + data.size();
+
+        // Font descriptor
+        append_block_header(QFF_FONT_DESCRIPTOR_TYPEID, sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+        append_le(QFF_MAGIC, 3);
+        append_le(0x01, 1); // version
+        append_le(total_size, 4);
+        append_le(~total_size, 4);
+        append_le(line_height, 1);
+        append_le(0, 1); // no ascii table
+        append_le(num_glyphs, 2);
+        append_le(GRAYSCALE_1BPP, 1);
+        append_le(0, 1); // flags
+        append_le(0, 1); // no compression
+        append_le(0, 1); // transparency index
+
+        // Unicode glyph table
+        append_block_header(QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID, unicode_len);
+        for (const Glyph& g : glyphs) {
+            append_le(g.code_point, 3);
+            append_le((width_offsets[g.width] << QFF_GLYPH_WIDTH_BITS) | g.width, 3);
+        }
+
+        // Glyph data
+        append_block_header(0x04, data.size());
+        bytes.insert(bytes.end(), data.begin(), data.end());
+    }
+
+    const void* buffer() const {
+        return bytes.data();
+    }
+
+    static std::string utf8(uint32_t code_point) {
+        std::string s;
+        if (code_point < 0x80) {
+            s += (char)code_point;
+        } else if (code_point < 0x800) {
+            s += (char)(0xC0 | (code_point >> 6));
+            s += (char)(0x80 | (code_point & 0x3F));
+        } else if (code_point < 0x10000) {
+            s += (char)(0xE0 | (code_point >> 12));
+            s += (char)(0x80 | ((code_point >> 6) & 0x3F));
+            s += (char)(0x80 | (code_point & 0x3F));
+        } else {
+            s += (char)(0xF0 | (code_point >> 18));
+            s += (char)(0x80 | ((code_point >> 12) & 0x3F));
+            s += (char)(0x80 | ((code_point >> 6) & 0x3F));
+            s += (char)(0x80 | (code_point & 0x3F));
+        }
+        return s;
+    }
+
+   private:
+    void append_le(uint32_t value, unsigned count) {
+        for (unsigned i = 0; i < count; ++i) {
+            bytes.push_back((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void append_block_header(uint8_t type_id, uint32_t length) {
+        append_le(type_id, 1);
+        append_le((~type_id) & 0xFF, 1);
+        append_le(length, 3);
+    }
+
+    std::vector<uint8_t> bytes;
+};
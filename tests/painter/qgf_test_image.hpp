@@ -0,0 +1,101 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "qgf.h"
+}
+
+// Builds a single frame, 4bpp grayscale QGF image in memory, shaded in diagonal stripes 4 pixels wide.
+class QGFTestImage {
+   public:
+    QGFTestImage(uint16_t width, uint16_t height, painter_compression_t compression = IMAGE_UNCOMPRESSED) {
+        std::vector<uint8_t> data((width * height + 1) / 2, 0);
+        for (uint32_t i = 0; i < (uint32_t)width * height; ++i) {
+            uint8_t shade = (((i % width) + (i / width)) / 4) % 16;
+            data[i / 2] |= shade << (4 * (i % 2));
+        }
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            data = rle_encode(data);
+        }
+
+        uint32_t frame_offset = sizeof(qgf_graphics_descriptor_v1_t) + sizeof(qgf_frame_offsets_v1_t) + sizeof(uint32_t);
+        uint32_t total_size   = frame_offset + sizeof(qgf_frame_v1_t) + sizeof(qgf_data_v1_t) + data.size();
+
+        // Graphics descriptor
+        append_block_header(QGF_GRAPHICS_DESCRIPTOR_TYPEID, sizeof(qgf_graphics_descriptor_v1_t) - sizeof(qgf_block_header_v1_t));
+        append_le(QGF_MAGIC, 3);
+        append_le(0x01, 1); // version
+        append_le(total_size, 4);
+        append_le(~total_size, 4);
+        append_le(width, 2);
+        append_le(height, 2);
+        append_le(1, 2); // frame count
+
+        // Frame offsets
+        append_block_header(QGF_FRAME_OFFSET_DESCRIPTOR_TYPEID, sizeof(uint32_t));
+        append_le(frame_offset, 4);
+
+        // Frame descriptor
+        append_block_header(QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t));
+        append_le(GRAYSCALE_4BPP, 1);
+        append_le(0, 1); // flags
+        append_le(compression, 1);
+        append_le(0, 1); // transparency index
+        append_le(0, 2); // delay
+
+        // Frame data
+        append_block_header(QGF_FRAME_DATA_DESCRIPTOR_TYPEID, data.size());
+        bytes.insert(bytes.end(), data.begin(), data.end());
+    }
+
+    const void* buffer() const {
+        return bytes.data();
+    }
+
+   private:
+    // Runs of up to 127 repeated bytes, or up to 128 literal bytes, as decoded by qp_drawimage_byte_rle_decoder()
+    static std::vector<uint8_t> rle_encode(const std::vector<uint8_t>& input) {
+        std::vector<uint8_t> output;
+        size_t               pos = 0;
+        while (pos < input.size()) {
+            size_t repeats = 1;
+            while (pos + repeats < input.size() && repeats < 127 && input[pos + repeats] == input[pos]) {
+                repeats++;
+            }
+            if (repeats >= 2) {
+                output.push_back(repeats);
+                output.push_back(input[pos]);
+                pos += repeats;
+                continue;
+            }
+
+            size_t literals = 1;
+            while (pos + literals < input.size() && literals < 128 && (pos + literals + 1 >= input.size() || input[pos + literals] != input[pos + literals + 1])) {
+                literals++;
+            }
+            output.push_back(127 + literals);
+            output.insert(output.end(), input.begin() + pos, input.begin() + pos + literals);
+            pos += literals;
+        }
+        return output;
+    }
+
+    void append_le(uint32_t value, unsigned count) {
+        for (unsigned i = 0; i < count; ++i) {
+            bytes.push_back((value >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void append_block_header(uint8_t type_id, uint32_t length) {
+        append_le(type_id, 1);
+        append_le((~type_id) & 0xFF, 1);
+        append_le(length, 3);
+    }
+
+    std::vector<uint8_t> bytes;
+};
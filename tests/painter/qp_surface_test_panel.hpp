@@ -0,0 +1,196 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Surface drawn onto a panel that keeps what it receives, shared by the surface suites with and without dirty tiles
+
+#include <cstdio>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_surface_internal.h"
+}
+
+static constexpr uint16_t panel_width  = 240;
+static constexpr uint16_t panel_height = 320;
+
+// Bytes a typical SPI panel sends to set its viewport: column and row address commands with their arguments, then the
+// command to start writing pixel data
+static constexpr uint32_t viewport_bytes = 3 + 2 * 4;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dummy comms, counting what a real panel would have sent
+
+static uint32_t bytes_sent;
+static uint32_t viewports_set;
+
+static uint32_t counting_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    bytes_sent += byte_count;
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+static painter_comms_vtable_t counting_comms_vtable;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Panel keeping what it receives, one pixel per element
+
+struct test_panel_t {
+    painter_driver_t base; // must be first, so it can be cast to/from the painter_device_t* type
+
+    uint16_t l, t, r, b;
+    uint16_t x, y;
+    uint16_t pixels[panel_width * panel_height];
+};
+
+static bool test_panel_noop(painter_device_t device) {
+    return true;
+}
+
+static bool test_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool test_panel_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool test_panel_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    test_panel_t *panel = (test_panel_t *)device;
+    panel->l = panel->x = left;
+    panel->t = panel->y = top;
+    panel->r            = right;
+    panel->b            = bottom;
+
+    uint8_t commands[viewport_bytes] = {0};
+    qp_comms_send(device, commands, sizeof(commands));
+    viewports_set++;
+    return true;
+}
+
+static bool test_panel_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    test_panel_t *panel = (test_panel_t *)device;
+    for (uint32_t i = 0; i < native_pixel_count; ++i) {
+        uint16_t value;
+        if (panel->base.native_bits_per_pixel == 16) {
+            value = ((const uint16_t *)pixel_data)[i];
+        } else {
+            value = (((const uint8_t *)pixel_data)[i / 8] >> (i % 8)) & 1;
+        }
+        if (panel->x < panel_width && panel->y < panel_height) {
+            panel->pixels[panel->y * panel_width + panel->x] = value;
+        }
+        if (++panel->x > panel->r) {
+            panel->x = panel->l;
+            panel->y++;
+        }
+    }
+
+    qp_comms_send(device, pixel_data, (native_pixel_count * panel->base.native_bits_per_pixel + 7) / 8);
+    return true;
+}
+
+static bool test_panel_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    return true;
+}
+
+static bool test_panel_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    return true;
+}
+
+static bool test_panel_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+static const painter_driver_vtable_t test_panel_vtable = {
+    .init            = test_panel_init,
+    .power           = test_panel_power,
+    .clear           = test_panel_noop,
+    .flush           = test_panel_noop,
+    .viewport        = test_panel_viewport,
+    .pixdata         = test_panel_pixdata,
+    .palette_convert = test_panel_palette_convert,
+    .append_pixels   = test_panel_append_pixels,
+    .append_pixdata  = test_panel_append_pixdata,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class QuantumPainterSurface : public testing::TestWithParam<uint8_t> {
+   protected:
+    void SetUp() override {
+        counting_comms_vtable            = dummy_comms_vtable;
+        counting_comms_vtable.comms_send = counting_comms_send;
+
+        framebuffer = new uint8_t[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 16)]();
+        surfaces    = new surface_painter_device_t[1]();
+        if (bpp() == 16) {
+            surface = qp_make_rgb565_surface_advanced(surfaces, 1, panel_width, panel_height, framebuffer);
+        } else {
+            surface = qp_make_mono1bpp_surface_advanced(surfaces, 1, panel_width, panel_height, framebuffer);
+        }
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        panel                             = new test_panel_t();
+        panel->base.driver_vtable         = &test_panel_vtable;
+        panel->base.comms_vtable          = &counting_comms_vtable;
+        panel->base.native_bits_per_pixel = bpp();
+        panel->base.panel_width           = panel_width;
+        panel->base.panel_height          = panel_height;
+        ASSERT_TRUE(qp_init((painter_device_t)panel, QP_ROTATION_0));
+
+        // Start from a panel in sync with the surface
+        ASSERT_TRUE(draw());
+    }
+
+    void TearDown() override {
+        delete panel;
+        delete[] surfaces;
+        delete[] framebuffer;
+    }
+
+    uint8_t bpp(void) {
+        return GetParam();
+    }
+
+    uint16_t surface_pixel(uint16_t x, uint16_t y) {
+        uint32_t pixel_num = y * panel_width + x;
+        return bpp() == 16 ? ((uint16_t *)framebuffer)[pixel_num] : (framebuffer[pixel_num / 8] >> (pixel_num % 8)) & 1;
+    }
+
+    void expect_panel_in_sync(void) {
+        for (uint16_t y = 0; y < panel_height; ++y) {
+            for (uint16_t x = 0; x < panel_width; ++x) {
+                ASSERT_EQ(panel->pixels[y * panel_width + x], surface_pixel(x, y)) << "at " << x << "," << y;
+            }
+        }
+    }
+
+    // Bytes the panel would have received for the dirty bounding box alone
+    uint32_t bounding_box_bytes(void) {
+        const surface_dirty_data_t &dirty = surfaces[0].dirty;
+        if (!dirty.is_dirty) {
+            return 0;
+        }
+        return viewport_bytes + ((uint32_t)(dirty.r - dirty.l + 1) * (dirty.b - dirty.t + 1) * bpp() + 7) / 8;
+    }
+
+    bool draw(void) {
+        bytes_sent    = 0;
+        viewports_set = 0;
+        return qp_surface_draw(surface, (painter_device_t)panel, 0, 0, false);
+    }
+
+    void report(const char *pattern, uint32_t bounding_box) {
+        printf("[ PAINTER  ] %2dbpp %-24s %7lu bytes in %3lu bursts, %7lu as a bounding box\n", bpp(), pattern, (unsigned long)bytes_sent, (unsigned long)viewports_set, (unsigned long)bounding_box);
+    }
+
+    uint8_t                  *framebuffer;
+    surface_painter_device_t *surfaces;
+    painter_device_t          surface;
+    test_panel_t             *panel;
+};
+
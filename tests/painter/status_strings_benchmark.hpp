@@ -0,0 +1,64 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include "gtest/gtest.h"
+#include "qff_test_font.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface_internal.h"
+}
+
+// Status widgets redrawing the same few short strings, each in its own fixed color. Built both with and without
+// QUANTUM_PAINTER_GLYPH_ATLAS_SIZE, so that the atlas can be compared against the plain decode path.
+struct StatusStringsBenchmark {
+    static constexpr uint16_t surface_width = 320;
+    static constexpr uint8_t  line_height   = 16;
+    static constexpr uint32_t first_glyph   = 0x4E00;
+    static constexpr unsigned num_strings   = 3;
+    static constexpr unsigned length        = 6;
+    static constexpr unsigned iterations    = 2000;
+
+    // Nanoseconds per string drawn
+    static uint64_t run(void) {
+        static uint16_t          framebuffer[surface_width * line_height];
+        surface_painter_device_t surfaces[1] = {};
+        memset(framebuffer, 0, sizeof(framebuffer));
+        painter_device_t surface = qp_make_rgb565_surface_advanced(surfaces, 1, surface_width, line_height, framebuffer);
+        EXPECT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        std::vector<QFFTestFont::Glyph> glyphs;
+        for (uint32_t code_point = first_glyph; code_point < first_glyph + num_strings * length; ++code_point) {
+            glyphs.push_back({code_point, (uint8_t)(6 + code_point % 4)});
+        }
+        QFFTestFont           font_data(line_height, glyphs);
+        painter_font_handle_t font = qp_load_font_mem(font_data.buffer());
+        EXPECT_NE(font, nullptr);
+
+        static constexpr uint8_t hues[num_strings] = {0, 85, 170};
+        std::string              strings[num_strings];
+        int16_t                  widths[num_strings] = {};
+        for (unsigned n = 0; n < num_strings; ++n) {
+            for (unsigned i = 0; i < length; ++i) {
+                uint32_t code_point = first_glyph + n * length + i;
+                strings[n] += QFFTestFont::utf8(code_point);
+                widths[n] += 6 + code_point % 4;
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < iterations; ++i) {
+            unsigned n = i % num_strings;
+            EXPECT_EQ(qp_drawtext_recolor(surface, 0, 0, font, strings[n].c_str(), hues[n], 255, 255, 0, 0, 0), widths[n]);
+        }
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        qp_close_font(font);
+        return elapsed / iterations;
+    }
+};
@@ -0,0 +1,161 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "qgf_test_image.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+}
+
+static constexpr uint16_t screen_width  = 240;
+static constexpr uint16_t screen_height = 240;
+static constexpr unsigned bench_iters   = 50;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoding packed palette indices
+
+struct DecodeInput {
+    const std::vector<uint8_t> &bytes;
+    size_t                      pos;
+};
+
+static int16_t read_byte(void *cb_arg) {
+    DecodeInput *input = (DecodeInput *)cb_arg;
+    return input->pos < input->bytes.size() ? input->bytes[input->pos++] : -1;
+}
+
+struct DecodeOutput {
+    std::vector<uint8_t> indices;
+    uint32_t             max_run;
+};
+
+static bool record_indices(qp_pixel_t *palette, uint8_t *palette_indices, uint32_t pixel_count, void *cb_arg) {
+    DecodeOutput *output = (DecodeOutput *)cb_arg;
+    output->indices.insert(output->indices.end(), palette_indices, palette_indices + pixel_count);
+    output->max_run = std::max(output->max_run, pixel_count);
+    return true;
+}
+
+TEST(QuantumPainterCodec, decodes_every_bpp_and_pixel_count) {
+    for (uint8_t bpp : {1, 2, 4, 8}) {
+        for (uint32_t pixel_count : {1u, 3u, 7u, 31u, 32u, 33u, 100u, 257u}) {
+            // Pack a known sequence of indices, least significant bits first
+            std::vector<uint8_t> expected, bytes((pixel_count * bpp + 7) / 8, 0);
+            for (uint32_t i = 0; i < pixel_count; ++i) {
+                uint8_t index = (i * 7 + 3) & ((1 << bpp) - 1);
+                expected.push_back(index);
+                bytes[i * bpp / 8] |= index << (i * bpp % 8);
+            }
+            bytes.push_back(0xAA); // never read
+
+            DecodeInput  input{bytes, 0};
+            DecodeOutput output{{}, 0};
+            ASSERT_TRUE(qp_internal_decode_palette(nullptr, pixel_count, bpp, read_byte, &input, qp_internal_global_pixel_lookup_table, record_indices, &output));
+            EXPECT_EQ(output.indices, expected) << (int)bpp << "bpp, " << pixel_count << " pixels";
+            EXPECT_EQ(input.pos, bytes.size() - 1) << (int)bpp << "bpp, " << pixel_count << " pixels";
+            EXPECT_LE(output.max_run, QP_INTERNAL_DECODE_BATCH_SIZE);
+        }
+    }
+}
+
+TEST(QuantumPainterCodec, fails_on_truncated_input) {
+    std::vector<uint8_t> bytes(3, 0x55);
+    DecodeInput          input{bytes, 0};
+    DecodeOutput         output{{}, 0};
+    EXPECT_FALSE(qp_internal_decode_palette(nullptr, 40, 1, read_byte, &input, qp_internal_global_pixel_lookup_table, record_indices, &output));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Palette index to native pixel kernels
+
+class QuantumPainterPixelKernels : public testing::Test {
+   protected:
+    void SetUp() override {
+        for (int i = 0; i < 16; ++i) {
+            palette[i].dummy = 0xA5000000 | (i * 0x0F1E2D);
+        }
+        for (size_t i = 0; i < sizeof(indices); ++i) {
+            indices[i] = (i * 5 + 1) % 16;
+        }
+    }
+
+    qp_pixel_t palette[16];
+    uint8_t    indices[19];
+};
+
+TEST_F(QuantumPainterPixelKernels, rgb565_matches_per_pixel_lookup) {
+    for (uint32_t offset = 0; offset < 4; ++offset) {
+        for (uint32_t count = 0; count <= sizeof(indices); ++count) {
+            uint16_t actual[32], expected[32];
+            memset(actual, 0x5A, sizeof(actual));
+            memset(expected, 0x5A, sizeof(expected));
+            for (uint32_t i = 0; i < count; ++i) {
+                expected[offset + i] = palette[indices[i]].rgb565;
+            }
+
+            qp_internal_palette_to_rgb565((uint8_t *)actual, palette, offset, count, indices);
+            ASSERT_EQ(memcmp(actual, expected, sizeof(actual)), 0) << "offset " << offset << ", count " << count;
+        }
+    }
+}
+
+TEST_F(QuantumPainterPixelKernels, rgb888_matches_per_pixel_lookup) {
+    for (uint32_t offset = 0; offset < 4; ++offset) {
+        for (uint32_t count = 0; count <= sizeof(indices); ++count) {
+            uint8_t actual[32 * 3], expected[32 * 3];
+            memset(actual, 0x5A, sizeof(actual));
+            memset(expected, 0x5A, sizeof(expected));
+            for (uint32_t i = 0; i < count; ++i) {
+                expected[(offset + i) * 3 + 0] = palette[indices[i]].rgb888.r;
+                expected[(offset + i) * 3 + 1] = palette[indices[i]].rgb888.g;
+                expected[(offset + i) * 3 + 2] = palette[indices[i]].rgb888.b;
+            }
+
+            qp_internal_palette_to_rgb888(actual, palette, offset, count, indices);
+            ASSERT_EQ(memcmp(actual, expected, sizeof(actual)), 0) << "offset " << offset << ", count " << count;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Full-screen image blits
+
+class QuantumPainterImageBlit : public testing::Test {
+   protected:
+    void SetUp() override {
+        framebuffer.assign(screen_width * screen_height, 0);
+        surface = qp_make_rgb565_surface_advanced(surfaces, 1, screen_width, screen_height, framebuffer.data());
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    }
+
+    std::vector<uint16_t>    framebuffer;
+    surface_painter_device_t surfaces[1] = {};
+    painter_device_t         surface;
+};
+
+TEST_F(QuantumPainterImageBlit, full_screen_benchmark) {
+    for (painter_compression_t compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        QGFTestImage           image_data(screen_width, screen_height, compression);
+        painter_image_handle_t image = qp_load_image_mem(image_data.buffer());
+        ASSERT_NE(image, nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < bench_iters; ++i) {
+            ASSERT_TRUE(qp_drawimage(surface, 0, 0, image));
+        }
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        printf("[ PAINTER  ] %ux%u 4bpp %s image: %8.2f Mpixels/s\n", screen_width, screen_height, compression == IMAGE_UNCOMPRESSED ? "raw" : "rle", (double)screen_width * screen_height * bench_iters * 1e3 / elapsed);
+
+        // The last stripe's shade runs into the bottom right corner
+        EXPECT_EQ(framebuffer[0], 0x0000);
+        EXPECT_EQ(framebuffer[screen_width * screen_height - 1], framebuffer[screen_width * screen_height - 2]);
+        qp_close_image(image);
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "gtest/gtest.h"
+#include "qp_surface_test_panel.hpp"
+
+TEST_P(QuantumPainterSurface, nothing_dirty_sends_nothing) {
+    ASSERT_TRUE(draw());
+    EXPECT_EQ(bytes_sent, 0);
+}
+
+// Without dirty tiles, everything between far apart changes is sent along with them
+TEST_P(QuantumPainterSurface, corner_pixels_send_the_bounding_box) {
+    qp_setpixel(surface, 0, 0, 0, 0, 255);
+    qp_setpixel(surface, panel_width - 1, panel_height - 1, 0, 0, 255);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+
+    EXPECT_EQ(viewports_set, 1);
+    EXPECT_EQ(bytes_sent, bounding_box);
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, small_change_sends_its_bounding_box) {
+    qp_rect(surface, 8, 4, 47, 19, 0, 0, 255, true);
+    uint32_t bounding_box = bounding_box_bytes();
+    ASSERT_TRUE(draw());
+
+    EXPECT_EQ(viewports_set, 1);
+    EXPECT_EQ(bytes_sent, bounding_box);
+    EXPECT_EQ(bytes_sent, viewport_bytes + (40 * 16 * bpp() + 7) / 8);
+    expect_panel_in_sync();
+}
+
+TEST_P(QuantumPainterSurface, entire_surface_is_one_burst) {
+    qp_setpixel(surface, 10, 10, 0, 0, 255);
+    bytes_sent    = 0;
+    viewports_set = 0;
+    ASSERT_TRUE(qp_surface_draw(surface, (painter_device_t)panel, 0, 0, true));
+
+    EXPECT_EQ(viewports_set, 1);
+    EXPECT_EQ(bytes_sent, viewport_bytes + SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, bpp()));
+}
+
+TEST_P(QuantumPainterSurface, random_shapes_stay_in_sync) {
+    std::mt19937 rng(1);
+    for (int i = 0; i < 50; ++i) {
+        uint16_t l = rng() % panel_width;
+        uint16_t t = rng() % panel_height;
+        uint16_t r = std::min<uint16_t>(panel_width - 1, l + rng() % 40);
+        uint16_t b = std::min<uint16_t>(panel_height - 1, t + rng() % 40);
+        qp_rect(surface, l, t, r, b, rng() % 256, 255, rng() % 256, rng() % 2);
+        if (i % 5 == 4) {
+            ASSERT_TRUE(draw());
+            expect_panel_in_sync();
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, QuantumPainterSurface, testing::Values(16, 1), [](const testing::TestParamInfo<uint8_t> &info) { return info.param == 16 ? "rgb565" : "mono1bpp"; });
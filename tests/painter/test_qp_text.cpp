@@ -0,0 +1,107 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "qff_test_font.hpp"
+#include "status_strings_benchmark.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+}
+
+static constexpr uint32_t first_code_point = 0x4E00;
+static constexpr uint16_t num_glyphs       = 5000;
+static constexpr uint8_t  line_height      = 8;
+
+static uint8_t glyph_width(uint32_t code_point) {
+    return 4 + (code_point % 4);
+}
+
+static std::vector<QFFTestFont::Glyph> make_glyphs() {
+    std::vector<QFFTestFont::Glyph> glyphs;
+    for (uint32_t i = 0; i < num_glyphs; ++i) {
+        glyphs.push_back({first_code_point + i, glyph_width(first_code_point + i)});
+    }
+    return glyphs;
+}
+
+class QuantumPainterText : public testing::Test {
+   protected:
+    void SetUp() override {
+        font_data = new QFFTestFont(line_height, make_glyphs());
+        font      = qp_load_font_mem(font_data->buffer());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+        delete font_data;
+    }
+
+    // Every 25th glyph in the font, wrapping as needed
+    std::string make_string(unsigned length, int16_t* expected_width) {
+        std::string str;
+        *expected_width = 0;
+        for (unsigned i = 0; i < length; ++i) {
+            uint32_t code_point = first_code_point + ((i * 25 + (i / 200)) % num_glyphs);
+            str += QFFTestFont::utf8(code_point);
+            *expected_width += glyph_width(code_point);
+        }
+        return str;
+    }
+
+    QFFTestFont*          font_data;
+    painter_font_handle_t font;
+};
+
+TEST_F(QuantumPainterText, finds_every_unicode_glyph) {
+    for (uint32_t code_point = first_code_point; code_point < first_code_point + num_glyphs; ++code_point) {
+        EXPECT_EQ(qp_textwidth(font, QFFTestFont::utf8(code_point).c_str()), glyph_width(code_point)) << "code point 0x" << std::hex << code_point;
+    }
+}
+
+TEST_F(QuantumPainterText, missing_glyphs_are_not_found) {
+    EXPECT_EQ(qp_textwidth(font, QFFTestFont::utf8(first_code_point - 1).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, QFFTestFont::utf8(first_code_point + num_glyphs).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, "A"), 0);
+}
+
+TEST_F(QuantumPainterText, unsorted_unicode_table_is_rejected) {
+    QFFTestFont unsorted(line_height, {{0x4E01, 4}, {0x4E00, 5}});
+    EXPECT_EQ(qp_load_font_mem(unsorted.buffer()), nullptr);
+
+    QFFTestFont duplicated(line_height, {{0x4E00, 4}, {0x4E00, 5}});
+    EXPECT_EQ(qp_load_font_mem(duplicated.buffer()), nullptr);
+}
+
+TEST_F(QuantumPainterText, draws_long_string) {
+    static uint8_t   framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(1600, line_height, 16)];
+    painter_device_t surface = qp_make_rgb565_surface(1600, line_height, framebuffer);
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    int16_t     expected_width;
+    std::string str = make_string(200, &expected_width);
+
+    constexpr unsigned iterations = 100;
+    auto               start      = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+        ASSERT_EQ(qp_drawtext(surface, 0, 0, font, str.c_str()), expected_width);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    // Glyphs are solid, so every pixel drawn should be white
+    uint16_t* pixels = (uint16_t*)framebuffer;
+    EXPECT_EQ(pixels[0], 0xFFFF);
+    EXPECT_EQ(pixels[expected_width - 1], 0xFFFF);
+    EXPECT_EQ(pixels[expected_width], 0x0000);
+
+    std::cout << "[ PAINTER  ] " << num_glyphs << " glyph font, " << (elapsed / (iterations * 200)) << " ns per drawn glyph" << std::endl;
+}
+
+// Baseline for the glyph_atlas suite's benchmark of the same strings, every glyph decoded
+TEST_F(QuantumPainterText, status_strings_benchmark) {
+    std::cout << "[ PAINTER  ] " << StatusStringsBenchmark::length << " glyph status strings: " << StatusStringsBenchmark::run() << " ns per string decoded" << std::endl;
+}
@@ -0,0 +1,14 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define SPLIT_TRANSACTION_BATCH_ENABLE
+#define DISABLE_SYNC_TIMER
+
+// Small enough that the layer states and the mods do not fit in a single batch
+#define SPLIT_TRANSACTION_BATCH_SIZE 8
@@ -0,0 +1,14 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CRC_ENABLE = yes
+
+# Same loopback as the parent directory, with the slave matrix sent as delta frames
+OPT_DEFS += -DSPLIT_KEYBOARD -DSPLIT_MATRIX_DELTA_ENABLE
+
+VPATH += $(QUANTUM_PATH)/split_common tests/split
+
+SRC += \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/split_matrix_delta.c \
+	tests/split/split_loopback.c
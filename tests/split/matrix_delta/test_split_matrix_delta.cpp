@@ -0,0 +1,116 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "crc.h"
+#include "matrix.h"
+#include "timer.h"
+#include "transactions.h"
+#include "split_loopback.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitMatrixDelta : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS]  = {0};
+    matrix_row_t slave_scan[HALF_ROWS]      = {0};
+
+    void SetUp() override {
+        loopback_reset();
+        // The master keeps its frame sequence across tests, let a keyframe pick up the reset slave
+        advance_time(SPLIT_MATRIX_KEYFRAME_MS);
+        scan();
+        memset(loopback_transaction_count, 0, sizeof(loopback_transaction_count));
+    }
+
+    void scan(void) {
+        EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+        advance_time(1);
+    }
+
+    /* What the slave's transactions_slave() does after each of its own scans. */
+    void slave_publish(void) {
+        split_matrix_delta_encode(&loopback_slave_memory.smatrix.delta, loopback_slave_memory.smatrix.matrix, slave_scan, HALF_ROWS);
+    }
+
+    void slave_toggle(uint8_t row, uint8_t col) {
+        slave_scan[row] ^= MATRIX_ROW_SHIFTER << col;
+        slave_publish();
+    }
+
+    void expect_in_sync(void) {
+        EXPECT_EQ(memcmp(slave_matrix, slave_scan, sizeof(slave_scan)), 0);
+    }
+};
+
+TEST_F(SplitMatrixDelta, IdleLinkOnlyPollsSequence) {
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_SEQUENCE], 1);
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DELTA], 0);
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 0);
+}
+
+TEST_F(SplitMatrixDelta, ChangeIsSentAsDelta) {
+    slave_toggle(1, 2);
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DELTA], 1);
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 0);
+    expect_in_sync();
+
+    slave_toggle(1, 2);
+    scan();
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DELTA], 2);
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 0);
+    expect_in_sync();
+}
+
+TEST_F(SplitMatrixDelta, MissedFrameTakesKeyframe) {
+    // Two slave scans between master scans, the first frame is never seen
+    slave_toggle(0, 0);
+    slave_toggle(1, 3);
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 1);
+    expect_in_sync();
+
+    slave_toggle(1, 3);
+    scan();
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 1);
+    expect_in_sync();
+}
+
+TEST_F(SplitMatrixDelta, CorruptedFrameTakesKeyframe) {
+    slave_toggle(1, 1);
+    loopback_slave_memory.smatrix.delta.values[0] ^= MATRIX_ROW_SHIFTER << 4;
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 1);
+    expect_in_sync();
+}
+
+TEST_F(SplitMatrixDelta, PeriodicKeyframe) {
+    advance_time(SPLIT_MATRIX_KEYFRAME_MS);
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DELTA], 1);
+    EXPECT_EQ(loopback_transaction_count[GET_SLAVE_MATRIX_DATA], 1);
+}
+
+TEST_F(SplitMatrixDelta, StatsCountFrameBytes) {
+    split_transaction_stats_t before = split_transaction_get_stats();
+    slave_toggle(0, 1);
+    scan();
+    split_transaction_stats_t after = split_transaction_get_stats();
+
+    EXPECT_EQ(after.bytes - before.bytes, sizeof(uint8_t) + sizeof(split_matrix_delta_t));
+}
@@ -0,0 +1,98 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "split_loopback.h"
+#include "transactions.h"
+#include "split_util.h"
+#include "crc.h"
+
+/*
+    Loopback transport: behaves like the serial transport, moving the full
+    registered buffer of each transaction between the master's shared memory
+    and a second block standing in for the slave, and running the slave
+    callback against that block.
+*/
+
+static split_shared_memory_t loopback_master_memory;
+split_shared_memory_t *const split_shmem = &loopback_master_memory;
+
+split_shared_memory_t loopback_slave_memory;
+uint32_t              loopback_transaction_count[NUM_TOTAL_TRANSACTIONS];
+int8_t                loopback_corrupt_transaction = -1;
+
+void loopback_reset(void) {
+    memset(&loopback_master_memory, 0, sizeof(loopback_master_memory));
+    memset(&loopback_slave_memory, 0, sizeof(loopback_slave_memory));
+    memset(loopback_transaction_count, 0, sizeof(loopback_transaction_count));
+    loopback_corrupt_transaction = -1;
+    // An idle slave half, with a consistent matrix checksum
+#ifdef SPLIT_MATRIX_DELTA_ENABLE
+    loopback_slave_memory.smatrix.delta.checksum = crc8(loopback_slave_memory.smatrix.matrix, sizeof(loopback_slave_memory.smatrix.matrix));
+#else
+    loopback_slave_memory.smatrix.checksum = crc8(loopback_slave_memory.smatrix.matrix, sizeof(loopback_slave_memory.smatrix.matrix));
+#endif
+}
+
+uint32_t loopback_total_transactions(void) {
+    uint32_t total = 0;
+    for (int i = 0; i < NUM_TOTAL_TRANSACTIONS; i++) {
+        total += loopback_transaction_count[i];
+    }
+    return total;
+}
+
+static void loopback_run_slave_callback(split_transaction_desc_t *trans) {
+    // The callback works on split_shmem, so present it with the slave's copy for the duration
+    static split_shared_memory_t saved_master;
+    memcpy(&saved_master, split_shmem, sizeof(saved_master));
+    memcpy(split_shmem, &loopback_slave_memory, sizeof(loopback_slave_memory));
+    trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    memcpy(&loopback_slave_memory, split_shmem, sizeof(loopback_slave_memory));
+    memcpy(split_shmem, &saved_master, sizeof(saved_master));
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    loopback_transaction_count[id]++;
+
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+    }
+    if (trans->initiator2target_buffer_size) {
+        uint8_t *slave = ((uint8_t *)&loopback_slave_memory) + trans->initiator2target_offset;
+        memcpy(slave, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        if (loopback_corrupt_transaction == id) {
+            slave[0] ^= 0xFF;
+            loopback_corrupt_transaction = -1;
+        }
+    }
+
+    if (trans->slave_callback) {
+        loopback_run_slave_callback(trans);
+    }
+
+    if (trans->target2initiator_buffer_size) {
+        const uint8_t *slave = ((const uint8_t *)&loopback_slave_memory) + trans->target2initiator_offset;
+        memcpy(split_trans_target2initiator_buffer(trans), slave, trans->target2initiator_buffer_size);
+    }
+    if (target2initiator_length > 0) {
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+void split_pre_init(void) {}
+
+void split_post_init(void) {}
@@ -0,0 +1,22 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "transport.h"
+#include "transaction_id_define.h"
+
+/* Shared memory as seen by the simulated slave half. */
+extern split_shared_memory_t loopback_slave_memory;
+
+/* Number of times each transaction went over the loopback "wire" since the last reset. */
+extern uint32_t loopback_transaction_count[NUM_TOTAL_TRANSACTIONS];
+
+/* When set, the next transfer of the given transaction arrives with its first byte flipped. */
+extern int8_t loopback_corrupt_transaction;
+
+void     loopback_reset(void);
+uint32_t loopback_total_transactions(void);
@@ -0,0 +1,13 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CRC_ENABLE = yes
+
+# Only the transactions are under test, the real transport is replaced by split_loopback.c
+OPT_DEFS += -DSPLIT_KEYBOARD
+
+VPATH += $(QUANTUM_PATH)/split_common
+
+SRC += \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	split_loopback.c
@@ -0,0 +1,135 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "action_layer.h"
+#include "action_util.h"
+#include "matrix.h"
+#include "timer.h"
+#include "transactions.h"
+#include "split_loopback.h"
+
+void advance_time(uint32_t ms);
+}
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[MATRIX_ROWS] = {0};
+    matrix_row_t slave_matrix[MATRIX_ROWS]  = {0};
+
+    void SetUp() override {
+        loopback_reset();
+        layer_state         = 0;
+        default_layer_state = 1;
+        clear_mods();
+        clear_weak_mods();
+        // Let every forced resync fire once, so that tests start from a settled link
+        advance_time(1000);
+        scan();
+        memset(loopback_transaction_count, 0, sizeof(loopback_transaction_count));
+    }
+
+    void scan(void) {
+        EXPECT_TRUE(transactions_master(master_matrix, slave_matrix));
+    }
+};
+
+TEST_F(SplitTransactions, UnchangedStateSendsNothing) {
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[PUT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_DEFAULT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_MODS], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_INFO], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 0);
+}
+
+TEST_F(SplitTransactions, LoneChangeUsesItsOwnTransaction) {
+    layer_state = 1 << 2;
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[PUT_LAYER_STATE], 1);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_INFO], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 0);
+    EXPECT_EQ(loopback_slave_memory.layers.layer_state, 1 << 2);
+}
+
+TEST_F(SplitTransactions, SimultaneousChangesAreCoalesced) {
+    layer_state         = 1 << 3;
+    default_layer_state = 1 << 1;
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[PUT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_DEFAULT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_INFO], 1);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 1);
+    EXPECT_EQ(loopback_slave_memory.layers.layer_state, 1 << 3);
+    EXPECT_EQ(loopback_slave_memory.layers.default_layer_state, 1 << 1);
+}
+
+TEST_F(SplitTransactions, OverflowSpillsIntoNextTransfer) {
+    layer_state         = 1 << 3;
+    default_layer_state = 1 << 1;
+    set_mods(MOD_BIT(KC_LEFT_SHIFT));
+    scan();
+
+    // Both layer states fill the batch, the mods are left on their own and go out directly
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_INFO], 1);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 1);
+    EXPECT_EQ(loopback_transaction_count[PUT_MODS], 1);
+    EXPECT_EQ(loopback_slave_memory.layers.layer_state, 1 << 3);
+    EXPECT_EQ(loopback_slave_memory.layers.default_layer_state, 1 << 1);
+    EXPECT_EQ(loopback_slave_memory.mods.real_mods, MOD_BIT(KC_LEFT_SHIFT));
+}
+
+TEST_F(SplitTransactions, ForcedResyncIsBatched) {
+    advance_time(100);
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[PUT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_DEFAULT_LAYER_STATE], 0);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_INFO], 1);
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 1);
+}
+
+TEST_F(SplitTransactions, MarkDirtyForcesSend) {
+    split_transaction_mark_dirty(PUT_DEFAULT_LAYER_STATE);
+    scan();
+    EXPECT_EQ(loopback_transaction_count[PUT_DEFAULT_LAYER_STATE], 1);
+
+    // The request is consumed by the send
+    scan();
+    EXPECT_EQ(loopback_transaction_count[PUT_DEFAULT_LAYER_STATE], 1);
+}
+
+TEST_F(SplitTransactions, CorruptBatchIsDropped) {
+    layer_state                  = 1 << 3;
+    default_layer_state          = 1 << 1;
+    loopback_corrupt_transaction = PUT_BATCH_DATA;
+    scan();
+
+    EXPECT_EQ(loopback_transaction_count[PUT_BATCH_DATA], 1);
+    EXPECT_EQ(loopback_slave_memory.layers.layer_state, 0);
+    EXPECT_EQ(loopback_slave_memory.layers.default_layer_state, 1);
+}
+
+TEST_F(SplitTransactions, StatsCountTransfers) {
+    split_transaction_stats_t before = split_transaction_get_stats();
+    layer_state                      = 1 << 3;
+    default_layer_state              = 1 << 1;
+    scan();
+    split_transaction_stats_t after = split_transaction_get_stats();
+
+    EXPECT_EQ(after.transactions - before.transactions, loopback_total_transactions());
+    EXPECT_GE(after.bytes - before.bytes, 2 * (1 + sizeof(layer_state_t)));
+
+    advance_time(1000);
+    scan();
+    after = split_transaction_get_stats();
+    EXPECT_GT(after.transactions_per_second, 0);
+    EXPECT_GT(after.bytes_per_second, 0);
+}
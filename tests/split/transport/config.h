@@ -0,0 +1,27 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+#include <stdint.h>
+
+#define SPLIT_TRANSPORT_MIRROR
+#define SPLIT_LAYER_STATE_ENABLE
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define SPLIT_ACTIVITY_ENABLE
+#define SPLIT_TRANSACTION_IDS_USER USER_SYNC_ECHO
+#define DISABLE_SYNC_TIMER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+uint32_t split_transport_timestamp(void);
+#ifdef __cplusplus
+}
+#endif
+
+/* Transactions are timed in host nanoseconds, the virtual millisecond timer only drives the throttles. */
+#define PROFILER_TIMESTAMP_GETTER split_transport_timestamp()
+#define PROFILER_HISTOGRAM_BUCKETS 32
@@ -0,0 +1,9 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CRC_ENABLE = yes
+PROFILER_ENABLE = yes
+
+# The real transport over the loopback serial driver, the slave half runs in a forked process
+SPLIT_KEYBOARD = yes
+SERIAL_DRIVER = loopback
@@ -0,0 +1,184 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <string.h>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "test_env.hpp"
+
+extern "C" {
+#include "action_layer.h"
+#include "action_util.h"
+#include "led.h"
+#include "matrix.h"
+#include "profiler.h"
+#include "transactions.h"
+#include "transport.h"
+#include "serial_loopback.h"
+
+void advance_time(uint32_t ms);
+}
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+extern "C" uint32_t split_transport_timestamp(void) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Each half is its own process, so the role only changes in the forked slave. */
+static bool keyboard_master = true;
+
+extern "C" bool is_keyboard_master(void) {
+    return keyboard_master;
+}
+
+////////////////////////////////////////////////////
+// Slave half, only ever runs in the forked process
+
+static matrix_row_t slave_half_matrix[HALF_ROWS];
+static matrix_row_t slave_half_mirror[MATRIX_ROWS];
+static uint32_t     slave_half_scans;
+
+static void slave_echo(uint8_t in_len, const void *in_data, uint8_t out_len, void *out_data) {
+    for (uint8_t i = 0; i < in_len && i < out_len; i++) {
+        ((uint8_t *)out_data)[i] = ((const uint8_t *)in_data)[i] + 1;
+    }
+}
+
+static void slave_init(void) {
+    keyboard_master = false;
+    memset(slave_half_matrix, 0, sizeof(slave_half_matrix));
+    slave_half_matrix[0] = 0b101;
+    slave_half_scans     = 0;
+    transaction_register_rpc(USER_SYNC_ECHO, slave_echo);
+    transport_slave_init();
+}
+
+static void slave_task(void) {
+    // A key changes state every 40 scans, on average, while typing
+    if (++slave_half_scans % 40 == 0) {
+        slave_half_matrix[1] ^= MATRIX_ROW_SHIFTER << (slave_half_scans / 40 % MATRIX_COLS);
+    }
+    transport_slave(slave_half_mirror, slave_half_matrix);
+}
+
+////////////////////////////////////////////////////
+// Master half
+
+class SplitTransport : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[HALF_ROWS] = {0};
+    matrix_row_t slave_matrix[HALF_ROWS]  = {0};
+
+    void SetUp() override {
+        layer_state         = 0;
+        default_layer_state = 1;
+        clear_mods();
+        ASSERT_TRUE(serial_loopback_start(slave_init, slave_task));
+        transport_master_init();
+    }
+
+    void TearDown() override {
+        serial_loopback_stop();
+    }
+
+    bool scan(void) {
+        bool okay = transport_master(master_matrix, slave_matrix);
+        advance_time(1);
+        return okay;
+    }
+};
+
+TEST_F(SplitTransport, SlaveMatrixReachesMaster) {
+    // The forked slave needs a moment to publish its first scan
+    for (int i = 0; i < 100 && slave_matrix[0] != 0b101; i++) {
+        EXPECT_TRUE(scan());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(slave_matrix[0], 0b101);
+}
+
+TEST_F(SplitTransport, RpcRunsOnSlave) {
+    uint8_t request[4] = {1, 2, 3, 4};
+    uint8_t response[4];
+    ASSERT_TRUE(transaction_rpc_exec(USER_SYNC_ECHO, sizeof(request), request, sizeof(response), response));
+
+    EXPECT_EQ(response[0], 2);
+    EXPECT_EQ(response[3], 5);
+    EXPECT_EQ(serial_loopback_get_stats(PUT_RPC_REQ_DATA)->count, 1);
+    EXPECT_EQ(serial_loopback_get_stats(PUT_RPC_REQ_DATA)->errors, 0);
+}
+
+TEST_F(SplitTransport, DisconnectedSlaveFailsTransactions) {
+    EXPECT_TRUE(scan());
+    serial_loopback_stop();
+    EXPECT_FALSE(scan());
+}
+
+struct named_id_t {
+    int8_t      id;
+    const char *name;
+};
+
+#define NAMED_ID(id) {id, #id}
+
+// clang-format off
+static const named_id_t transactions[] = {
+    NAMED_ID(GET_SLAVE_MATRIX_CHECKSUM), NAMED_ID(GET_SLAVE_MATRIX_DATA), NAMED_ID(PUT_MASTER_MATRIX),
+    NAMED_ID(PUT_LAYER_STATE), NAMED_ID(PUT_DEFAULT_LAYER_STATE), NAMED_ID(PUT_LED_STATE), NAMED_ID(PUT_MODS),
+    NAMED_ID(PUT_ACTIVITY),
+};
+// clang-format on
+
+/* Master handlers in transactions_master(), profiled as split_<name>. */
+static const char *handlers[] = {"split_slave_matrix", "split_master_matrix", "split_layer_state", "split_led_state", "split_mods", "split_activity"};
+
+/**
+ * Runs SPLIT_TRANSPORT_SCANS master scans (default 2000) back to back against the forked slave, changing the synced
+ * state along the way, and prints per transaction and per handler how often it ran and how long it took in real time.
+ * A handler's maximum is the worst stall it added to a single scan, retries included.
+ */
+TEST_F(SplitTransport, Benchmark) {
+    unsigned scans = env_or("SPLIT_TRANSPORT_SCANS", 2000);
+
+    profiler_reset();
+    serial_loopback_reset_stats();
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 1; i <= scans; i++) {
+        if (i % 25 == 0) {
+            master_matrix[i % HALF_ROWS] ^= MATRIX_ROW_SHIFTER << (i % MATRIX_COLS);
+        }
+        if (i % 150 == 0) {
+            layer_state ^= 1 << 1;
+        }
+        if (i % 60 == 0) {
+            set_mods(get_mods() ^ MOD_BIT(KC_LEFT_SHIFT));
+        }
+        EXPECT_TRUE(scan());
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint32_t total = 0;
+    for (int id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        total += serial_loopback_get_stats(id)->count;
+    }
+    printf("scans:        %u in %.3f s, %.0f scans/sec\n", scans, seconds, scans / seconds);
+    printf("transactions: %lu, %.0f/sec\n", (unsigned long)total, total / seconds);
+
+    printf("%-28s %8s %10s %10s %10s %6s\n", "transaction", "count", "per sec", "avg us", "max us", "errors");
+    for (const auto &transaction : transactions) {
+        const serial_loopback_stats_t *s = serial_loopback_get_stats(transaction.id);
+        printf("%-28s %8lu %10.0f %10.1f %10.1f %6lu\n", transaction.name, (unsigned long)s->count, s->count / seconds, s->count ? s->total_ns / 1000.0 / s->count : 0.0, s->max_ns / 1000.0, (unsigned long)s->errors);
+        EXPECT_EQ(s->errors, 0) << transaction.name;
+    }
+
+    printf("%-28s %8s %10s %10s %10s\n", "handler", "scans", "per sec", "avg us", "stall us");
+    for (const char *name : handlers) {
+        profiler_probe_t *probe = profiler_find_probe(name);
+        ASSERT_NE(probe, nullptr) << name << " did not run";
+        printf("%-28s %8lu %10.0f %10.1f %10.1f\n", name, (unsigned long)probe->count, probe->count / seconds, probe->total / 1000.0 / probe->count, probe->max / 1000.0);
+    }
+}
@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+/**
+ * Numeric value of an environment variable, such as a benchmark's iteration count, or the fallback if it isn't set.
+ */
+inline uint64_t env_or(const char *name, uint64_t fallback) {
+    const char *value = std::getenv(name);
+    return value ? std::strtoull(value, nullptr, 0) : fallback;
+}